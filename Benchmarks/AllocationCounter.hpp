@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+// Replaces global operators new and delete to count heap allocations and allocated bytes, include it in one file of
+// benchmark executable. Copies are not counted directly, copied strings and buffers show up as bytes they allocate
+namespace allocations
+{
+    inline std::atomic<size_t> count = 0;
+    inline std::atomic<size_t> bytes = 0;
+
+    inline size_t getCount() { return count.load(std::memory_order_relaxed); }
+
+    inline size_t getBytes() { return bytes.load(std::memory_order_relaxed); }
+
+    inline void *allocate(size_t size) noexcept
+    {
+        count.fetch_add(1, std::memory_order_relaxed);
+        bytes.fetch_add(size, std::memory_order_relaxed);
+        return std::malloc(size ? size : 1);
+    }
+
+    inline void *allocate(size_t size, std::align_val_t alignment) noexcept
+    {
+        count.fetch_add(1, std::memory_order_relaxed);
+        bytes.fetch_add(size, std::memory_order_relaxed);
+        auto align = static_cast<size_t>(alignment);
+        // aligned_alloc requires size to be multiple of alignment
+        auto rounded = (size + align - 1) / align * align;
+#ifdef _WIN32
+        return _aligned_malloc(rounded ? rounded : align, align);
+#else
+        return std::aligned_alloc(align, rounded ? rounded : align);
+#endif
+    }
+
+    inline void deallocate(void *ptr) noexcept { std::free(ptr); }
+
+    inline void deallocate(void *ptr, std::align_val_t) noexcept
+    {
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    template <class... Alignment> void *allocateOrThrow(size_t size, Alignment... alignment)
+    {
+        if (auto ptr = allocate(size, alignment...))
+        {
+            return ptr;
+        }
+        throw std::bad_alloc{};
+    }
+} // namespace allocations
+
+void *operator new(size_t size) { return allocations::allocateOrThrow(size); }
+
+void *operator new[](size_t size) { return allocations::allocateOrThrow(size); }
+
+void *operator new(size_t size, std::align_val_t alignment) { return allocations::allocateOrThrow(size, alignment); }
+
+void *operator new[](size_t size, std::align_val_t alignment) { return allocations::allocateOrThrow(size, alignment); }
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return allocations::allocate(size); }
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return allocations::allocate(size); }
+
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return allocations::allocate(size, alignment);
+}
+
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return allocations::allocate(size, alignment);
+}
+
+void operator delete(void *ptr) noexcept { allocations::deallocate(ptr); }
+
+void operator delete[](void *ptr) noexcept { allocations::deallocate(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { allocations::deallocate(ptr); }
+
+void operator delete[](void *ptr, size_t) noexcept { allocations::deallocate(ptr); }
+
+void operator delete(void *ptr, std::align_val_t alignment) noexcept { allocations::deallocate(ptr, alignment); }
+
+void operator delete[](void *ptr, std::align_val_t alignment) noexcept { allocations::deallocate(ptr, alignment); }
+
+void operator delete(void *ptr, size_t, std::align_val_t alignment) noexcept
+{
+    allocations::deallocate(ptr, alignment);
+}
+
+void operator delete[](void *ptr, size_t, std::align_val_t alignment) noexcept
+{
+    allocations::deallocate(ptr, alignment);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { allocations::deallocate(ptr); }
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { allocations::deallocate(ptr); }
+
+void operator delete(void *ptr, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    allocations::deallocate(ptr, alignment);
+}
+
+void operator delete[](void *ptr, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    allocations::deallocate(ptr, alignment);
+}
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "Common/InlineExecutor.hpp"
+#include "DI/ServiceProvider.hpp"
+#include "Engine/ConnectionInfo.hpp"
+#include "Engine/Context.hpp"
+#include "Engine/Endpoint.hpp"
+#include "Engine/FromHeader.hpp"
+#include "Engine/FromQuery.hpp"
+#include "Engine/FromRoute.hpp"
+#include "Engine/RequestArena.hpp"
+#include "Http/DefaultHeaders.hpp"
+#include "Router/Router.hpp"
+
+template <class Binder> static void BinderBenchmark(benchmark::State &state)
+{
+    static constexpr std::string_view Path = "/api/users/42";
+    sd::NativeRequest native{boost::beast::http::verb::get, "/api/users/42?page=3&active=True&ratio=0.5&bad=x1", 11};
+    native.set("X-Count", "7");
+
+    sd::Router router;
+    router.addEndpoint(
+        std::make_unique<sd::Endpoint>(sd::HttpMethod::Get, "/api/users/{id:int}", [](sd::IContext &) {}));
+    router.compile();
+
+    sd::ServiceCollection collection;
+    sd::ServiceContainer singletons;
+    sd::ServiceProvider services{collection, singletons};
+    sd::ConnectionInfo info;
+    sd::DefaultHeaders defaultHeaders;
+    sd::RequestArena arena;
+    sd::InlineExecutor executor;
+    sd::Context ctx{native, info, defaultHeaders, arena, services, executor};
+    ctx.getRoutingData().setMatch(std::string{Path}, router.match(sd::HttpMethod::Get, Path));
+
+    for (auto _ : state)
+    {
+        Binder binder{ctx};
+        benchmark::DoNotOptimize(binder.isBound());
+    }
+}
+
+BENCHMARK_TEMPLATE(BinderBenchmark, sd::FromRouteInt<"id">);
+BENCHMARK_TEMPLATE(BinderBenchmark, sd::FromRoute<"id">);
+BENCHMARK_TEMPLATE(BinderBenchmark, sd::FromQueryInt<"page">);
+BENCHMARK_TEMPLATE(BinderBenchmark, sd::FromQueryBool<"active">);
+BENCHMARK_TEMPLATE(BinderBenchmark, sd::FromQueryDouble<"ratio">);
+BENCHMARK_TEMPLATE(BinderBenchmark, sd::FromQueryFloat<"ratio">);
+BENCHMARK_TEMPLATE(BinderBenchmark, sd::FromQueryIntOpt<"missing">);
+BENCHMARK_TEMPLATE(BinderBenchmark, sd::FromHeaderInt<"X-Count">);
+// malformed input, binding error is recorded without throwing
+BENCHMARK_TEMPLATE(BinderBenchmark, sd::FromQueryInt<"bad">);
+BENCHMARK_TEMPLATE(BinderBenchmark, sd::FromHeaderInt<"X-Missing">);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "AllocationCounter.hpp"
+#include "SevenBitRest.hpp"
+
+using namespace std::string_literals;
+
+// Whole request handling (middlewares, router, binders, endpoint, response) without sockets, numbers include
+// conversion of test request and response, it is the same for all cases
+static void runPipeline(benchmark::State &state, sd::WebApplication &app, const sd::TestRequest &request)
+{
+    sd::TestServer server{app};
+    // first request initializes application
+    if (server.send(request).statusCode == 0)
+    {
+        state.SkipWithError("no response");
+    }
+
+    auto before = allocations::getCount();
+    for (auto _ : state)
+    {
+        auto response = server.send(request);
+        benchmark::DoNotOptimize(response);
+    }
+    state.counters["allocations"] = benchmark::Counter(static_cast<double>(allocations::getCount() - before),
+                                                       benchmark::Counter::kAvgIterations);
+}
+
+static void PipelineEndpointBenchmark(benchmark::State &state)
+{
+    auto app = sd::WebApplicationBuilder{}.build();
+    app.mapGet("/api/users", []() { return "users"s; });
+
+    runPipeline(state, app, {.target = "/api/users"});
+}
+
+static void PipelineBindersBenchmark(benchmark::State &state)
+{
+    auto app = sd::WebApplicationBuilder{}.build();
+    app.mapGet("/api/users/{id:int}",
+               [](sd::FromRouteInt<"id"> id, sd::FromQueryInt<"page"> page, sd::FromHeader<"X-Tag"> tag) {
+                   return std::to_string(*id + *page) + *tag;
+               });
+
+    runPipeline(state, app, {.target = "/api/users/42?page=3", .headers = {{"X-Tag", "a"}}});
+}
+
+static void PipelineAsyncEndpointBenchmark(benchmark::State &state)
+{
+    auto app = sd::WebApplicationBuilder{}.build();
+    app.mapGet("/api/users", []() -> sd::Task<std::string> { co_return "users"s; });
+
+    runPipeline(state, app, {.target = "/api/users"});
+}
+
+static void PipelineMiddlewaresBenchmark(benchmark::State &state)
+{
+    auto app = sd::WebApplicationBuilder{}.build();
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        app.useSingleton([](sd::IContext &, sd::INextCallback &next) { next(); });
+    }
+    app.mapGet("/api/users", []() { return "users"s; });
+
+    runPipeline(state, app, {.target = "/api/users"});
+}
+
+static void PipelineNotFoundBenchmark(benchmark::State &state)
+{
+    auto app = sd::WebApplicationBuilder{}.build();
+    app.mapGet("/api/users", []() { return "users"s; });
+
+    runPipeline(state, app, {.target = "/api/missing"});
+}
+
+static void PipelinePostBenchmark(benchmark::State &state)
+{
+    auto app = sd::WebApplicationBuilder{}.build();
+    app.mapPost("/api/users", [](sd::FromBody<sd::Json> body) { return (*body).at("name").get_string(); });
+
+    runPipeline(state, app,
+                {.method = sd::HttpMethod::Post,
+                 .target = "/api/users",
+                 .headers = {{"Content-Type", "application/json"}},
+                 .body = R"({"name": "john", "age": 42})"});
+}
+
+BENCHMARK(PipelineEndpointBenchmark);
+BENCHMARK(PipelineBindersBenchmark);
+BENCHMARK(PipelineAsyncEndpointBenchmark);
+BENCHMARK(PipelineMiddlewaresBenchmark)->Arg(1)->Arg(4)->Arg(16);
+BENCHMARK(PipelineNotFoundBenchmark);
+BENCHMARK(PipelinePostBenchmark);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+#include <boost/beast/http/message_generator.hpp>
+#include <string>
+
+#include "AllocationCounter.hpp"
+#include "Engine/ConnectionInfo.hpp"
+#include "Engine/RequestArena.hpp"
+#include "Http/DefaultHeaders.hpp"
+#include "Http/Request.hpp"
+#include "Http/Response.hpp"
+
+template <bool Copy> static void ResponseHandoffBenchmark(benchmark::State &state)
+{
+    sd::NativeRequest native{boost::beast::http::verb::get, "/api/users", 11};
+    sd::ConnectionInfo info;
+    sd::DefaultHeaders defaultHeaders;
+    size_t handoffBytes = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        sd::RequestArena arena;
+        sd::Request request{native, info, arena};
+        sd::Response response{request, defaultHeaders, arena};
+        response.setBody(std::string(state.range(0), 'x'));
+        auto before = allocations::getBytes();
+        state.ResumeTiming();
+
+        // old handoff returned prepared response by value, copying headers and body
+        auto prepared = [&]() -> sd::NativeResponse {
+            if constexpr (Copy)
+            {
+                sd::NativeResponse copy = response.takeNative();
+                return sd::NativeResponse{copy};
+            }
+            else
+            {
+                return response.takeNative();
+            }
+        }();
+        boost::beast::http::message_generator msg{std::move(prepared)};
+        benchmark::DoNotOptimize(msg);
+
+        handoffBytes += allocations::getBytes() - before;
+    }
+    // all heap bytes allocated during handoff, message generator included, not only copied body and headers
+    state.counters["bytesAllocated"] =
+        benchmark::Counter(static_cast<double>(handoffBytes), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(ResponseHandoffBenchmark<false>)->Arg(1024)->Arg(1024 * 1024);
+BENCHMARK(ResponseHandoffBenchmark<true>)->Arg(1024)->Arg(1024 * 1024);
+
+BENCHMARK_MAIN();
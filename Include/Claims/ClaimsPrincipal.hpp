@@ -95,6 +95,18 @@ namespace sd
             return hasClaim([&](Claim &claim) { return claim.getType() == type && claim.getValue() == value; });
         }
 
+        bool isAuthenticated() const
+        {
+            for (auto &identity : _identities)
+            {
+                if (identity.isAuthenticated())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         bool isInRole(std::string_view role) const
         {
             if (auto claim = findFirst(ClaimTypes::Role))
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+namespace sd
+{
+    // Per-request arena usage collected since application start
+    struct ArenaStatistics
+    {
+        uint64_t requests = 0;
+        uint64_t allocatedBytes = 0;
+        uint64_t maxRequestBytes = 0;
+        uint64_t overflows = 0; // requests that did not fit in thread buffer and allocated from heap
+    };
+} // namespace sd
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <coroutine>
+
+namespace sd
+{
+    // Runs resumed coroutines on threads owned by the application
+    struct IExecutor
+    {
+        // Queues handle to be resumed on one of executor threads, nested posts do not grow the stack
+        virtual void post(std::coroutine_handle<> handle) = 0;
+
+        virtual bool runningInThisThread() const = 0;
+
+        // true when post resumes handle on calling thread instead of handing it to executor threads
+        virtual bool postsInline() const { return false; }
+
+        virtual ~IExecutor() = default;
+    };
+
+    // Awaiting it always continues coroutine through executor queue, used to spread work between threads
+    inline auto schedule(IExecutor &executor)
+    {
+        struct Awaiter
+        {
+            IExecutor &executor;
+
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle) { executor.post(handle); }
+
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{executor};
+    }
+} // namespace sd
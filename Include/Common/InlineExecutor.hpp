@@ -0,0 +1,50 @@
+#pragma once
+
+#include <coroutine>
+#include <deque>
+
+#include "Common/IExecutor.hpp"
+
+namespace sd
+{
+    // Resumes posted handles on calling thread, handles posted while draining are queued so stack does not grow
+    class InlineExecutor final : public IExecutor
+    {
+      private:
+        struct Queue
+        {
+            std::deque<std::coroutine_handle<>> handles;
+            bool draining = false;
+        };
+
+      public:
+        void post(std::coroutine_handle<> handle)
+        {
+            auto &queue = getQueue();
+            queue.handles.push_back(handle);
+            if (queue.draining)
+            {
+                return;
+            }
+            queue.draining = true;
+            while (!queue.handles.empty())
+            {
+                auto next = queue.handles.front();
+                queue.handles.pop_front();
+                next.resume();
+            }
+            queue.draining = false;
+        }
+
+        bool runningInThisThread() const { return true; }
+
+        bool postsInline() const { return true; }
+
+      private:
+        static Queue &getQueue()
+        {
+            thread_local Queue queue;
+            return queue;
+        }
+    };
+} // namespace sd
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sd
+{
+    template <class Signature, size_t Capacity = 48> class InlineFunction;
+
+    // std::function replacement, callables up to Capacity bytes are stored inline, bigger ones on the heap
+    template <class R, class... Args, size_t Capacity> class InlineFunction<R(Args...), Capacity>
+    {
+      private:
+        struct VTable
+        {
+            R (*invoke)(void *storage, Args &&...args);
+            void (*copy)(const void *from, void *to);
+            void (*move)(void *from, void *to) noexcept;
+            void (*destroy)(void *storage) noexcept;
+        };
+
+        template <class F> static constexpr bool IsInline = sizeof(F) <= Capacity &&
+                                                            alignof(F) <= alignof(std::max_align_t) &&
+                                                            std::is_nothrow_move_constructible_v<F>;
+
+        template <class F> static constexpr VTable InlineVTable{
+            [](void *storage, Args &&...args) -> R {
+                return std::invoke(*static_cast<F *>(storage), std::forward<Args>(args)...);
+            },
+            [](const void *from, void *to) { new (to) F(*static_cast<const F *>(from)); },
+            [](void *from, void *to) noexcept {
+                new (to) F(std::move(*static_cast<F *>(from)));
+                static_cast<F *>(from)->~F();
+            },
+            [](void *storage) noexcept { static_cast<F *>(storage)->~F(); }};
+
+        template <class F> static constexpr VTable HeapVTable{
+            [](void *storage, Args &&...args) -> R {
+                return std::invoke(**static_cast<F **>(storage), std::forward<Args>(args)...);
+            },
+            [](const void *from, void *to) { *static_cast<F **>(to) = new F(**static_cast<F *const *>(from)); },
+            [](void *from, void *to) noexcept { *static_cast<F **>(to) = *static_cast<F **>(from); },
+            [](void *storage) noexcept { delete *static_cast<F **>(storage); }};
+
+        alignas(std::max_align_t) unsigned char _storage[Capacity];
+        const VTable *_vtable = nullptr;
+
+      public:
+        InlineFunction() = default;
+        InlineFunction(std::nullptr_t) {}
+
+        template <class F, class = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineFunction> &&
+                                                    std::is_invocable_r_v<R, std::decay_t<F> &, Args...>>>
+        InlineFunction(F &&fcn)
+        {
+            using Fcn = std::decay_t<F>;
+            static_assert(std::is_copy_constructible_v<Fcn>, "Callable must be copy constructible");
+            if constexpr (IsInline<Fcn>)
+            {
+                new (_storage) Fcn(std::forward<F>(fcn));
+                _vtable = &InlineVTable<Fcn>;
+            }
+            else
+            {
+                *reinterpret_cast<Fcn **>(_storage) = new Fcn(std::forward<F>(fcn));
+                _vtable = &HeapVTable<Fcn>;
+            }
+        }
+
+        InlineFunction(const InlineFunction &other) { copyFrom(other); }
+
+        InlineFunction(InlineFunction &&other) noexcept { moveFrom(other); }
+
+        InlineFunction &operator=(const InlineFunction &other)
+        {
+            if (this != &other)
+            {
+                reset();
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        InlineFunction &operator=(InlineFunction &&other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        R operator()(Args... args) const
+        {
+            if (!_vtable)
+            {
+                throw std::bad_function_call{};
+            }
+            return _vtable->invoke(const_cast<unsigned char *>(_storage), std::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const { return _vtable != nullptr; }
+
+        ~InlineFunction() { reset(); }
+
+      private:
+        void copyFrom(const InlineFunction &other)
+        {
+            if (other._vtable)
+            {
+                other._vtable->copy(other._storage, _storage);
+                _vtable = other._vtable;
+            }
+        }
+
+        void moveFrom(InlineFunction &other) noexcept
+        {
+            if (other._vtable)
+            {
+                other._vtable->move(other._storage, _storage);
+                _vtable = std::exchange(other._vtable, nullptr);
+            }
+        }
+
+        void reset() noexcept
+        {
+            if (_vtable)
+            {
+                std::exchange(_vtable, nullptr)->destroy(_storage);
+            }
+        }
+    };
+} // namespace sd
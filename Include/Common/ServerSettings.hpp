@@ -12,6 +12,13 @@ namespace sd
         Http3 = 4
     };
 
+    struct CertificateSettings
+    {
+        std::vector<std::string> hosts; // SNI host names, "*.example.com" matches direct subdomains
+        std::string certificateFile;
+        std::string privateKeyFile;
+    };
+
     struct ServerSettings
     {
         Protocol protocol = Protocol::Http2;
@@ -19,5 +26,11 @@ namespace sd
         uint16_t threadsNumber = 0;
         size_t timeoutSec = 30;
         size_t bodyLimit = 31'457'280; // 30 MB
+        bool useDateHeader = true;
+        std::string serverHeader;                      // empty - Server header is not sent
+        std::string certificateFile;                   // PEM certificate chain, empty - built in certificate
+        std::string privateKeyFile;                    // PEM private key
+        std::vector<CertificateSettings> certificates; // additional certificates selected by SNI
+        size_t certificateWatchIntervalSec = 0;        // 0 - certificate files are not watched
     };
 } // namespace sd
\ No newline at end of file
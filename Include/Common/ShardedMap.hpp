@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace sd::utils
+{
+    // Hash is mixed so shard choice does not correlate with bucket choice inside shard map
+    template <size_t Shards> size_t getShardIndex(size_t hash)
+    {
+        return ((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> 32) % Shards;
+    }
+
+    // Concurrent hash map split into independently locked shards, so threads using different keys rarely contend
+    template <class Key, class Value, size_t Shards = 16, class Hash = std::hash<Key>> class ShardedMap
+    {
+      public:
+        using Map = std::unordered_map<Key, Value, Hash>;
+
+      private:
+        struct alignas(64) Shard
+        {
+            std::mutex mutex;
+            Map map;
+        };
+
+        std::array<Shard, Shards> _shards;
+        Hash _hash;
+
+      public:
+        // fcn receives map of the shard owning key and runs under shard lock
+        template <class Fcn> decltype(auto) apply(const Key &key, Fcn &&fcn)
+        {
+            auto &shard = getShard(key);
+            std::lock_guard lock{shard.mutex};
+            return fcn(shard.map);
+        }
+
+        bool erase(const Key &key)
+        {
+            return apply(key, [&](Map &map) { return map.erase(key) > 0; });
+        }
+
+        size_t size()
+        {
+            size_t result = 0;
+            for (auto &shard : _shards)
+            {
+                std::lock_guard lock{shard.mutex};
+                result += shard.map.size();
+            }
+            return result;
+        }
+
+      private:
+        Shard &getShard(const Key &key) { return _shards[getShardIndex<Shards>(_hash(key))]; }
+    };
+} // namespace sd::utils
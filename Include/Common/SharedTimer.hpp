@@ -0,0 +1,159 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace sd
+{
+    // Single background thread running timers of all rate limiters and bulkheads, started with first timer.
+    // Callbacks run one at a time on timer thread, so they should only do short work or post it to executor
+    class SharedTimer
+    {
+      public:
+        using Clock = std::chrono::steady_clock;
+        using Id = uint64_t;
+
+        // returns time of next run, nullopt stops timer
+        using Callback = std::function<std::optional<Clock::time_point>()>;
+
+      private:
+        struct Timer
+        {
+            Clock::time_point at;
+            Callback callback;
+        };
+
+        std::mutex _mutex;
+        std::condition_variable _signal;
+        std::unordered_map<Id, Timer> _timers;
+        Id _nextId = 1;
+        Id _running = 0;
+        bool _runningCancelled = false;
+        bool _stopping = false;
+        std::thread _thread;
+
+      public:
+        static SharedTimer &getInstance()
+        {
+            static SharedTimer timer;
+            return timer;
+        }
+
+        SharedTimer() = default;
+
+        SharedTimer(const SharedTimer &) = delete;
+        SharedTimer &operator=(const SharedTimer &) = delete;
+
+        Id start(Clock::time_point at, Callback callback)
+        {
+            std::lock_guard lock{_mutex};
+            if (!_thread.joinable())
+            {
+                _thread = std::thread{[this] { run(); }};
+            }
+            auto id = _nextId++;
+            _timers.emplace(id, Timer{at, std::move(callback)});
+            _signal.notify_all();
+            return id;
+        }
+
+        // Once it returns callback is not running and will not run again, called from callback it only stops timer
+        void cancel(Id id)
+        {
+            std::unique_lock lock{_mutex};
+            _timers.erase(id);
+            if (_running != id)
+            {
+                return;
+            }
+            _runningCancelled = true;
+            if (std::this_thread::get_id() != _thread.get_id())
+            {
+                _signal.wait(lock, [&] { return _running != id; });
+            }
+        }
+
+        ~SharedTimer()
+        {
+            {
+                std::lock_guard lock{_mutex};
+                _stopping = true;
+            }
+            _signal.notify_all();
+            if (_thread.joinable())
+            {
+                _thread.join();
+            }
+        }
+
+      private:
+        void run()
+        {
+            std::unique_lock lock{_mutex};
+            while (!_stopping)
+            {
+                auto next = findNext();
+                if (next == _timers.end())
+                {
+                    _signal.wait(lock);
+                    continue;
+                }
+                if (auto at = next->second.at; at > Clock::now())
+                {
+                    _signal.wait_until(lock, at);
+                    continue;
+                }
+                auto id = next->first;
+                auto callback = std::move(next->second.callback);
+                _timers.erase(next);
+                _running = id;
+                _runningCancelled = false;
+                lock.unlock();
+
+                auto at = invoke(callback);
+
+                lock.lock();
+                if (at && !_runningCancelled)
+                {
+                    _timers.emplace(id, Timer{*at, std::move(callback)});
+                }
+                _running = 0;
+                _signal.notify_all();
+            }
+        }
+
+        // timers are few (one per limiter or bulkhead), linear search is enough
+        std::unordered_map<Id, Timer>::iterator findNext()
+        {
+            auto next = _timers.begin();
+            for (auto it = _timers.begin(); it != _timers.end(); ++it)
+            {
+                if (it->second.at < next->second.at)
+                {
+                    next = it;
+                }
+            }
+            return next;
+        }
+
+        // failing callback stops its timer, exception can not escape timer thread
+        static std::optional<Clock::time_point> invoke(Callback &callback)
+        {
+            try
+            {
+                return callback();
+            }
+            catch (...)
+            {
+                return std::nullopt;
+            }
+        }
+    };
+} // namespace sd
@@ -1,78 +1,470 @@
 #pragma once
 
-#include <experimental/coroutine>
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
 #include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Common/IExecutor.hpp"
 
 namespace sd
 {
-    template <typename T = void> struct Task
+    template <class T = void> class Task;
+
+    template <class T> struct IsTask : std::false_type
+    {
+    };
+
+    template <class T> struct IsTask<Task<T>> : std::true_type
+    {
+    };
+
+    template <class T> inline constexpr bool IsTaskV = IsTask<T>::value;
+
+    namespace details
     {
-        template <typename U> struct task_promise;
+        // Coroutine frames are recycled per thread, frames freed on other thread go to that thread cache
+        class FrameCache
+        {
+          private:
+            static constexpr size_t Granularity = 256;
+            static constexpr size_t MaxFrameSize = 4 * 1024;
+            static constexpr size_t MaxCachedFrames = 32;
 
-        using promise_type = task_promise<T>;
-        using handle_type = std::experimental::coroutine_handle<promise_type>;
+            struct FreeFrame
+            {
+                FreeFrame *next;
+            };
 
-        mutable handle_type _handle;
+            struct Bucket
+            {
+                FreeFrame *head = nullptr;
+                size_t count = 0;
+            };
 
-        Task(handle_type handle) : _handle(handle) {}
+            std::array<Bucket, MaxFrameSize / Granularity> _buckets;
 
-        Task(Task &&other) noexcept : _handle(other._handle) { other._handle = nullptr; };
+          public:
+            static void *allocate(size_t size)
+            {
+                if (size > MaxFrameSize)
+                {
+                    return ::operator new(size);
+                }
+                auto &bucket = get()._buckets[getIndex(size)];
+                if (auto frame = bucket.head)
+                {
+                    bucket.head = frame->next;
+                    --bucket.count;
+                    return frame;
+                }
+                return ::operator new((getIndex(size) + 1) * Granularity);
+            }
 
-        bool await_ready() { return _handle.done(); }
+            static void deallocate(void *ptr, size_t size) noexcept
+            {
+                if (size > MaxFrameSize)
+                {
+                    return ::operator delete(ptr);
+                }
+                auto &bucket = get()._buckets[getIndex(size)];
+                if (bucket.count == MaxCachedFrames)
+                {
+                    return ::operator delete(ptr);
+                }
+                bucket.head = new (ptr) FreeFrame{bucket.head};
+                ++bucket.count;
+            }
 
-        bool await_suspend(std::experimental::coroutine_handle<> handle)
-        {
-            if (!_handle.done())
+            ~FrameCache()
             {
-                _handle.resume();
+                for (auto &bucket : _buckets)
+                {
+                    while (auto frame = bucket.head)
+                    {
+                        bucket.head = frame->next;
+                        ::operator delete(frame);
+                    }
+                }
             }
 
-            return false;
-        }
+          private:
+            static size_t getIndex(size_t size) { return (size - 1) / Granularity; }
 
-        auto await_resume() { return result(); }
+            static FrameCache &get()
+            {
+                thread_local FrameCache cache;
+                return cache;
+            }
+        };
+
+        // Self destroying coroutine resuming target on executor thread, inline when it already runs there
+        struct ExecutorHop
+        {
+            struct promise_type
+            {
+                std::coroutine_handle<> target;
+
+                static void *operator new(size_t size) { return FrameCache::allocate(size); }
+
+                static void operator delete(void *ptr, size_t size) noexcept { FrameCache::deallocate(ptr, size); }
+
+                ExecutorHop get_return_object() noexcept
+                {
+                    return {std::coroutine_handle<promise_type>::from_promise(*this)};
+                }
 
-        T result() const
+                std::suspend_always initial_suspend() noexcept { return {}; }
+
+                auto final_suspend() noexcept
+                {
+                    struct Awaiter
+                    {
+                        bool await_ready() noexcept { return false; }
+
+                        std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> hop) noexcept
+                        {
+                            auto target = hop.promise().target;
+                            hop.destroy();
+                            return target;
+                        }
+
+                        void await_resume() noexcept {}
+                    };
+                    return Awaiter{};
+                }
+
+                void return_void() noexcept {}
+
+                void unhandled_exception() noexcept { std::terminate(); }
+            };
+
+            std::coroutine_handle<promise_type> handle;
+        };
+
+        inline ExecutorHop hopTo(IExecutor &executor)
         {
-            if (!_handle.done())
-                _handle.resume();
+            struct Awaiter
+            {
+                IExecutor &executor;
 
-            if (_handle.promise().m_exception)
-                std::rethrow_exception(_handle.promise().m_exception);
+                bool await_ready() const { return executor.runningInThisThread(); }
 
-            return *_handle.promise().m_value;
+                void await_suspend(std::coroutine_handle<> handle) { executor.post(handle); }
+
+                void await_resume() const noexcept {}
+            };
+            co_await Awaiter{executor};
         }
 
-        ~Task()
+        template <class Awaitable> decltype(auto) getAwaiter(Awaitable &&awaitable)
         {
-            if (_handle)
-                _handle.destroy();
+            if constexpr (requires { std::forward<Awaitable>(awaitable).operator co_await(); })
+            {
+                return std::forward<Awaitable>(awaitable).operator co_await();
+            }
+            else if constexpr (requires { operator co_await(std::forward<Awaitable>(awaitable)); })
+            {
+                return operator co_await(std::forward<Awaitable>(awaitable));
+            }
+            else
+            {
+                return std::forward<Awaitable>(awaitable);
+            }
         }
 
-        template <typename U> struct task_promise
+        // Awaiter of non task awaitable, task continues on its executor even if awaitable completes on other thread
+        template <class Awaiter> struct ExecutorAwaiter
+        {
+            Awaiter awaiter;
+            IExecutor *executor;
+
+            bool await_ready() { return awaiter.await_ready(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> target)
+            {
+                if (!executor)
+                {
+                    return suspend(target, target);
+                }
+                auto hop = hopTo(*executor).handle;
+                hop.promise().target = target;
+                try
+                {
+                    return suspend(hop, target);
+                }
+                catch (...)
+                {
+                    hop.destroy();
+                    throw;
+                }
+            }
+
+            decltype(auto) await_resume() { return awaiter.await_resume(); }
+
+          private:
+            std::coroutine_handle<> suspend(std::coroutine_handle<> resumer, std::coroutine_handle<> target)
+            {
+                using Result = decltype(awaiter.await_suspend(resumer));
+                if constexpr (std::is_void_v<Result>)
+                {
+                    awaiter.await_suspend(resumer);
+                    return std::noop_coroutine();
+                }
+                else if constexpr (std::is_same_v<Result, bool>)
+                {
+                    if (awaiter.await_suspend(resumer))
+                    {
+                        return std::noop_coroutine();
+                    }
+                    if (resumer != target)
+                    {
+                        resumer.destroy();
+                    }
+                    return target;
+                }
+                else
+                {
+                    return awaiter.await_suspend(resumer);
+                }
+            }
+        };
+
+        struct TaskPromiseBase
+        {
+            struct FinalAwaiter
+            {
+                bool await_ready() noexcept { return false; }
+
+                template <class Promise> std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    return handle.promise().continuation;
+                }
+
+                void await_resume() noexcept {}
+            };
+
+            std::coroutine_handle<> continuation = std::noop_coroutine();
+            std::exception_ptr exception;
+            IExecutor *executor = nullptr;
+
+            static void *operator new(size_t size) { return FrameCache::allocate(size); }
+
+            static void operator delete(void *ptr, size_t size) noexcept { FrameCache::deallocate(ptr, size); }
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            FinalAwaiter final_suspend() noexcept { return {}; }
+
+            void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+            // Awaited tasks inherit executor, other awaitables resume task through it
+            template <class Awaitable> decltype(auto) await_transform(Awaitable &&awaitable)
+            {
+                if constexpr (IsTaskV<std::remove_cvref_t<Awaitable>>)
+                {
+                    return std::forward<Awaitable>(awaitable);
+                }
+                else
+                {
+                    using Awaiter = decltype(getAwaiter(std::forward<Awaitable>(awaitable)));
+                    return ExecutorAwaiter<Awaiter>{getAwaiter(std::forward<Awaitable>(awaitable)), executor};
+                }
+            }
+
+            void rethrowIfFailed()
+            {
+                if (exception)
+                {
+                    std::rethrow_exception(exception);
+                }
+            }
+        };
+
+        template <class T> struct TaskPromise : TaskPromiseBase
         {
-            std::optional<T> _value{};
-            std::exception_ptr _exception = nullptr;
+            std::optional<T> value;
 
-            auto initial_suspend() { return std::experimental::suspend_always{}; }
+            Task<T> get_return_object() noexcept;
 
-            auto final_suspend() { return std::experimental::suspend_always{}; }
+            template <class U> void return_value(U &&result) { value.emplace(std::forward<U>(result)); }
 
-            auto return_value(T t)
+            T takeResult()
             {
-                _value = t;
-                return std::experimental::suspend_always{};
+                rethrowIfFailed();
+                return std::move(*value);
             }
+        };
+
+        template <> struct TaskPromise<void> : TaskPromiseBase
+        {
+            Task<void> get_return_object() noexcept;
+
+            void return_void() noexcept {}
+
+            void takeResult() { rethrowIfFailed(); }
+        };
+
+        // Self destroying coroutine used to start task without awaiting it
+        struct DetachedTask
+        {
+            struct promise_type
+            {
+                static void *operator new(size_t size) { return FrameCache::allocate(size); }
+
+                static void operator delete(void *ptr, size_t size) noexcept { FrameCache::deallocate(ptr, size); }
+
+                DetachedTask get_return_object() noexcept { return {}; }
+
+                std::suspend_never initial_suspend() noexcept { return {}; }
+
+                std::suspend_never final_suspend() noexcept { return {}; }
+
+                void return_void() noexcept {}
+
+                void unhandled_exception() noexcept { std::terminate(); }
+            };
+        };
+    } // namespace details
 
-            Task<T> get_return_object() { return {handle_type::from_promise(*this)}; }
+    // Lazily started coroutine, awaiting it runs the coroutine and resumes awaiter once it completes
+    template <class T> class [[nodiscard]] Task
+    {
+      public:
+        using promise_type = details::TaskPromise<T>;
+        using value_type = T;
+
+      private:
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Handle _handle;
+
+        struct Awaiter
+        {
+            Handle handle;
 
-            void unhandled_exception() { _exception = std::current_exception(); }
+            bool await_ready() const noexcept { return handle.done(); }
 
-            void rethrow_if_unhandled_exception()
+            template <class Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting) noexcept
             {
-                if (_exception)
-                    std::rethrow_exception(std::move(_exception));
+                auto &promise = handle.promise();
+                promise.continuation = awaiting;
+                if constexpr (std::is_base_of_v<details::TaskPromiseBase, Promise>)
+                {
+                    if (auto executor = awaiting.promise().executor)
+                    {
+                        promise.executor = executor;
+                    }
+                }
+                return handle;
             }
+
+            T await_resume() { return handle.promise().takeResult(); }
         };
+
+      public:
+        Task() = default;
+        explicit Task(Handle handle) : _handle(handle) {}
+
+        Task(Task &&other) noexcept : _handle(std::exchange(other._handle, nullptr)) {}
+
+        Task &operator=(Task &&other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                _handle = std::exchange(other._handle, nullptr);
+            }
+            return *this;
+        }
+
+        Task(const Task &) = delete;
+        Task &operator=(const Task &) = delete;
+
+        explicit operator bool() const { return static_cast<bool>(_handle); }
+
+        Awaiter operator co_await() const
+        {
+            if (!_handle)
+            {
+                throw std::runtime_error("Can not await empty task");
+            }
+            return Awaiter{_handle};
+        }
+
+        // Executor resuming task after non task awaitables complete, set on root task
+        void setExecutor(IExecutor &executor)
+        {
+            if (_handle)
+            {
+                _handle.promise().executor = &executor;
+            }
+        }
+
+        ~Task() { reset(); }
+
+      private:
+        void reset()
+        {
+            if (_handle)
+            {
+                std::exchange(_handle, nullptr).destroy();
+            }
+        }
     };
-} // namespace sd
\ No newline at end of file
+
+    template <class T> Task<T> details::TaskPromise<T>::get_return_object() noexcept
+    {
+        return Task<T>{std::coroutine_handle<TaskPromise<T>>::from_promise(*this)};
+    }
+
+    inline Task<void> details::TaskPromise<void>::get_return_object() noexcept
+    {
+        return Task<void>{std::coroutine_handle<TaskPromise<void>>::from_promise(*this)};
+    }
+
+    // Awaits task holding guard (for example concurrency slot), guard is released as soon as task completes
+    template <class Guard> Task<> holdDuring(Task<> task, Guard guard)
+    {
+        // local is destroyed when body ends, parameters only with the frame
+        auto held = std::move(guard);
+        co_await task;
+    }
+
+    // Runs task without awaiting it, callback receives exception (null on success) and result
+    template <class T, class Callback> details::DetachedTask startTask(Task<T> task, Callback callback)
+    {
+        std::exception_ptr exception;
+        if constexpr (std::is_void_v<T>)
+        {
+            try
+            {
+                co_await task;
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+            callback(exception);
+        }
+        else
+        {
+            std::optional<T> result;
+            try
+            {
+                result.emplace(co_await task);
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+            callback(exception, std::move(result));
+        }
+    }
+} // namespace sd
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <algorithm>
+#include <cctype>
 #include <charconv>
 #include <cstddef>
+#include <cstdlib>
 #include <memory>
 #include <optional>
 #include <string>
@@ -20,7 +22,7 @@
 
 namespace sd::utils
 {
-    template <class T> T &getRequired(std::unique_ptr<T> &ptr)
+    template <class T, class Deleter> T &getRequired(std::unique_ptr<T, Deleter> &ptr)
     {
         if (ptr)
         {
@@ -75,51 +77,90 @@ namespace sd::utils
             }
         }
 
+        constexpr std::string_view view() const { return {value, N - 1}; }
+
         char value[N] = {'\0'};
     };
 
-    template <class T> T convert(const std::string &val)
+    inline bool iequals(std::string_view left, std::string_view right)
+    {
+        return std::equal(left.begin(), left.end(), right.begin(), right.end(), [](unsigned char l, unsigned char r) {
+            return std::tolower(l) == std::tolower(r);
+        });
+    }
+
+    template <class T> bool fromChars(std::string_view val, T &result)
+    {
+        auto end = val.data() + val.size();
+        auto [ptr, err] = std::from_chars(val.data(), end, result);
+        return err == std::errc{} && ptr == end;
+    }
+
+#if !defined(__cpp_lib_to_chars) || __cpp_lib_to_chars < 201611L
+    // standard library without floating point from_chars
+    template <> inline bool fromChars(std::string_view val, float &result)
+    {
+        std::string copy{val};
+        char *end = nullptr;
+        result = std::strtof(copy.c_str(), &end);
+        return !copy.empty() && end == copy.c_str() + copy.size();
+    }
+
+    template <> inline bool fromChars(std::string_view val, double &result)
     {
-        static_assert(notSupportedType<T>, "This Type is not supported, please use int, string, bool");
+        std::string copy{val};
+        char *end = nullptr;
+        result = std::strtod(copy.c_str(), &end);
+        return !copy.empty() && end == copy.c_str() + copy.size();
     }
+#endif
 
-    template <> inline std::string convert(const std::string &val) { return val; }
-    template <> inline int convert(const std::string &val) { return std::stoi(val); }
-    template <> inline float convert(const std::string &val) { return std::stof(val); }
-    template <> inline double convert(const std::string &val) { return std::stod(val); }
-    template <> inline bool convert(const std::string &val)
+    // Whole value must be consumed, returns false instead of throwing so malformed input stays cheap
+    template <class T> bool tryConvert(std::string_view val, T &result)
     {
-        auto copy = val;
-        std::transform(copy.begin(), copy.end(), copy.begin(), [](unsigned char c) { return std::tolower(c); });
-        if (copy == "true")
+        if constexpr (std::is_same_v<T, std::string>)
         {
+            result.assign(val);
             return true;
         }
-        if (copy == "false")
+        else if constexpr (std::is_same_v<T, bool>)
         {
+            if (iequals(val, "true"))
+            {
+                result = true;
+                return true;
+            }
+            if (iequals(val, "false"))
+            {
+                result = false;
+                return true;
+            }
+            int number = 0;
+            if (fromChars(val, number))
+            {
+                result = number != 0;
+                return true;
+            }
             return false;
         }
-        try
+        else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>)
         {
-            return convert<int>(val) != 0;
+            return fromChars(val, result);
         }
-        catch (...)
+        else
         {
+            static_assert(notSupportedType<T>, "This Type is not supported, please use int, string, bool");
         }
-        throw std::bad_cast{};
     }
 
-    template <class T> bool tryConvert(const std::string &val, T &result)
+    template <class T> T convert(std::string_view val)
     {
-        try
+        T result{};
+        if (!tryConvert(val, result))
         {
-            result = convert<T>(val);
-            return true;
+            throw std::bad_cast{};
         }
-        catch (...)
-        {
-        }
-        return false;
+        return result;
     }
 
     template <typename T, typename Enable = void> struct IsOptional : std::false_type
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace sd::utils
+{
+    // Streaming XXH64 (https://github.com/Cyan4973/xxHash), input is consumed in 32 byte stripes by four
+    // independent lanes so the compiler can keep them in flight together. Assumes little endian host
+    class XxHash64
+    {
+      private:
+        static constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ull;
+        static constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4Full;
+        static constexpr uint64_t Prime3 = 0x165667B19E3779F9ull;
+        static constexpr uint64_t Prime4 = 0x85EBCA77C2B2AE63ull;
+        static constexpr uint64_t Prime5 = 0x27D4EB2F165667C5ull;
+        static constexpr size_t StripeSize = 32;
+
+        uint64_t _seed;
+        std::array<uint64_t, 4> _lanes;
+        std::array<char, StripeSize> _buffer;
+        size_t _buffered = 0;
+        uint64_t _length = 0;
+
+      public:
+        explicit XxHash64(uint64_t seed = 0)
+            : _seed(seed), _lanes{seed + Prime1 + Prime2, seed + Prime2, seed, seed - Prime1}
+        {
+        }
+
+        static uint64_t hash(std::string_view data, uint64_t seed = 0)
+        {
+            XxHash64 hasher{seed};
+            hasher.update(data);
+            return hasher.digest();
+        }
+
+        void update(std::string_view data)
+        {
+            _length += data.size();
+            if (_buffered)
+            {
+                auto size = std::min(StripeSize - _buffered, data.size());
+                std::memcpy(_buffer.data() + _buffered, data.data(), size);
+                _buffered += size;
+                data.remove_prefix(size);
+                if (_buffered < StripeSize)
+                {
+                    return;
+                }
+                consume(_buffer.data());
+                _buffered = 0;
+            }
+            for (; data.size() >= StripeSize; data.remove_prefix(StripeSize))
+            {
+                consume(data.data());
+            }
+            std::memcpy(_buffer.data(), data.data(), data.size());
+            _buffered = data.size();
+        }
+
+        uint64_t digest() const
+        {
+            uint64_t hash;
+            if (_length >= StripeSize)
+            {
+                hash = rotl(_lanes[0], 1) + rotl(_lanes[1], 7) + rotl(_lanes[2], 12) + rotl(_lanes[3], 18);
+                for (auto lane : _lanes)
+                {
+                    hash = (hash ^ round(0, lane)) * Prime1 + Prime4;
+                }
+            }
+            else
+            {
+                hash = _seed + Prime5;
+            }
+            hash += _length;
+
+            auto data = _buffer.data();
+            auto end = data + _buffered;
+            for (; data + 8 <= end; data += 8)
+            {
+                hash = rotl(hash ^ round(0, read<uint64_t>(data)), 27) * Prime1 + Prime4;
+            }
+            if (data + 4 <= end)
+            {
+                hash = rotl(hash ^ (read<uint32_t>(data) * Prime1), 23) * Prime2 + Prime3;
+                data += 4;
+            }
+            for (; data < end; ++data)
+            {
+                hash = rotl(hash ^ (static_cast<unsigned char>(*data) * Prime5), 11) * Prime1;
+            }
+
+            hash ^= hash >> 33;
+            hash *= Prime2;
+            hash ^= hash >> 29;
+            hash *= Prime3;
+            hash ^= hash >> 32;
+            return hash;
+        }
+
+      private:
+        void consume(const char *stripe)
+        {
+            for (size_t i = 0; i < _lanes.size(); ++i)
+            {
+                _lanes[i] = round(_lanes[i], read<uint64_t>(stripe + i * 8));
+            }
+        }
+
+        static uint64_t round(uint64_t lane, uint64_t input) { return rotl(lane + input * Prime2, 31) * Prime1; }
+
+        static uint64_t rotl(uint64_t value, int bits) { return (value << bits) | (value >> (64 - bits)); }
+
+        template <class T> static uint64_t read(const char *data)
+        {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+    };
+} // namespace sd::utils
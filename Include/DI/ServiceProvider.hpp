@@ -408,7 +408,10 @@ namespace sd
             }
         }
 
-        ServiceProvider::Ptr createScoped() { return std::make_unique<ServiceProvider>(_collection, _singletons); }
+        ServiceProvider::Ptr createScoped() { return std::make_unique<ServiceProvider>(makeScoped()); }
+
+        // Scoped provider returned by value so caller decides where it lives
+        ServiceProvider makeScoped() { return ServiceProvider{_collection, _singletons}; }
 
       private:
         void *createAndRegister(TypeId typeId)
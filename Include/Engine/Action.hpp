@@ -1,10 +1,16 @@
 #pragma once
 
-#include <functional>
-
-#include "Engine/IContext.hpp"
+#include "Common/InlineFunction.hpp"
 
 namespace sd
 {
-    using Action = std::function<void(IContext &)>;
-}
\ No newline at end of file
+    struct IContext;
+
+    using Action = InlineFunction<void(IContext &)>;
+
+    // Runs before endpoint action, returning false stops processing (task is responsible for the response then)
+    using PreTask = InlineFunction<bool(IContext &)>;
+
+    // Runs after endpoint action
+    using PostTask = InlineFunction<void(IContext &)>;
+} // namespace sd
@@ -1,11 +1,60 @@
 #pragma once
 
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "Common/Utils.hpp"
 #include "Engine/IContext.hpp"
 
 namespace sd
 {
+    struct BindingError
+    {
+        std::string_view name;
+        std::string_view reason;
+    };
+
+    // Binding failures are recorded instead of thrown, action checks them before invoking handler
     struct BaseParam
     {
         BaseParam(IContext &) {}
+
+        bool isBound() const { return _error.reason.empty(); }
+
+        const BindingError &getError() const { return _error; }
+
+      protected:
+        template <class T> void bind(std::string_view name, std::optional<std::string_view> param, T &value)
+        {
+            if constexpr (utils::IsOptionalV<T>)
+            {
+                if (param)
+                {
+                    typename T::value_type converted{};
+                    if (!utils::tryConvert(*param, converted))
+                    {
+                        return fail(name, "The value has invalid format.");
+                    }
+                    value = std::move(converted);
+                }
+            }
+            else
+            {
+                if (!param)
+                {
+                    return fail(name, "The value is required.");
+                }
+                if (!utils::tryConvert(*param, value))
+                {
+                    return fail(name, "The value has invalid format.");
+                }
+            }
+        }
+
+        void fail(std::string_view name, std::string_view reason) { _error = {name, reason}; }
+
+      private:
+        BindingError _error;
     };
-} // namespace sd
\ No newline at end of file
+} // namespace sd
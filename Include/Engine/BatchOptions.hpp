@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+namespace sd
+{
+    struct BatchOptions
+    {
+        // bigger batches are rejected with 400
+        size_t maxRequests = 50;
+
+        // sub-requests are spread over server threads instead of running one after another
+        bool parallel = false;
+    };
+} // namespace sd
@@ -0,0 +1,276 @@
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/IExecutor.hpp"
+#include "Common/Json.hpp"
+#include "Common/SharedTimer.hpp"
+
+namespace sd
+{
+    struct BulkheadOptions
+    {
+        static inline const std::string MaxConcurrency = "maxConcurrency";
+        static inline const std::string MaxQueue = "maxQueue";
+        static inline const std::string QueueTimeoutMs = "queueTimeoutMs";
+
+        uint32_t maxConcurrency = 16;
+        uint32_t maxQueue = 32;
+        std::chrono::milliseconds queueTimeout{100};
+
+        // reads fields present in configuration section, for example
+        // {"maxConcurrency": 4, "maxQueue": 8, "queueTimeoutMs": 50}
+        static BulkheadOptions fromJson(const Json *section, BulkheadOptions defaults)
+        {
+            if (!section || !section->is_object())
+            {
+                return defaults;
+            }
+            if (auto value = section->find(MaxConcurrency); value && value->is_number())
+            {
+                defaults.maxConcurrency = value->as<uint32_t>();
+            }
+            if (auto value = section->find(MaxQueue); value && value->is_number())
+            {
+                defaults.maxQueue = value->as<uint32_t>();
+            }
+            if (auto value = section->find(QueueTimeoutMs); value && value->is_number())
+            {
+                defaults.queueTimeout = std::chrono::milliseconds{value->as<int64_t>()};
+            }
+            return defaults;
+        }
+    };
+
+    struct BulkheadStatistics
+    {
+        uint32_t inFlight = 0;
+        uint32_t queued = 0;
+        uint64_t rejected = 0; // queue was full
+        uint64_t timedOut = 0; // waited longer than queue timeout
+    };
+
+    // Concurrency quota shared by endpoints of one group. Requests over quota wait in bounded FIFO queue without
+    // blocking threads, shared timer rejects waiters once their queue timeout passes
+    class Bulkhead
+    {
+      public:
+        using Ptr = std::shared_ptr<Bulkhead>;
+        using Clock = std::chrono::steady_clock;
+
+        enum class Admission
+        {
+            Admitted,
+            MustWait,
+            Rejected
+        };
+
+        // Awaiting it queues caller, resumes with true once slot was handed over. Waiter is resumed through
+        // executor, so thread releasing slot does not run it
+        class Entry
+        {
+          private:
+            friend Bulkhead;
+
+            Bulkhead &_bulkhead;
+            IExecutor &_executor;
+            Clock::time_point _deadline;
+            std::coroutine_handle<> _handle;
+            bool _admitted = false;
+
+          public:
+            Entry(Bulkhead &bulkhead, IExecutor &executor)
+                : _bulkhead(bulkhead), _executor(executor), _deadline(Clock::now() + bulkhead._options.queueTimeout)
+            {
+            }
+
+            bool await_ready() { return false; }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                _handle = handle;
+                return _bulkhead.enqueue(*this);
+            }
+
+            bool await_resume() const { return _admitted; }
+        };
+
+        // Taken slot, returned when destroyed
+        class Slot
+        {
+          private:
+            Bulkhead *_bulkhead;
+
+          public:
+            explicit Slot(Bulkhead &bulkhead) : _bulkhead(&bulkhead) {}
+
+            Slot(Slot &&other) noexcept : _bulkhead(std::exchange(other._bulkhead, nullptr)) {}
+
+            Slot &operator=(Slot &&) = delete;
+
+            ~Slot()
+            {
+                if (_bulkhead)
+                {
+                    _bulkhead->leave();
+                }
+            }
+        };
+
+      private:
+        BulkheadOptions _options;
+        std::mutex _mutex;
+        uint32_t _inFlight = 0;
+        std::deque<Entry *> _queue;
+        uint64_t _rejected = 0;
+        uint64_t _timedOut = 0;
+        SharedTimer::Id _timer = 0; // last started expiry timer
+        bool _timerRunning = false;
+
+      public:
+        explicit Bulkhead(BulkheadOptions options = {}) : _options(options) {}
+
+        Bulkhead(const Bulkhead &) = delete;
+        Bulkhead &operator=(const Bulkhead &) = delete;
+
+        // queued waiters are released not admitted, so their requests answer 503 instead of waiting forever
+        ~Bulkhead()
+        {
+            std::vector<Entry *> waiters;
+            SharedTimer::Id timer;
+            {
+                std::lock_guard lock{_mutex};
+                waiters.assign(_queue.begin(), _queue.end());
+                _queue.clear();
+                timer = _timer;
+            }
+            resume(waiters);
+            if (timer)
+            {
+                SharedTimer::getInstance().cancel(timer);
+            }
+        }
+
+        // Admitted caller owns slot and must wrap it in Slot, MustWait caller awaits enter()
+        Admission tryEnter()
+        {
+            std::lock_guard lock{_mutex};
+            if (_inFlight < _options.maxConcurrency)
+            {
+                ++_inFlight;
+                return Admission::Admitted;
+            }
+            if (_queue.size() < _options.maxQueue)
+            {
+                return Admission::MustWait;
+            }
+            ++_rejected;
+            return Admission::Rejected;
+        }
+
+        Entry enter(IExecutor &executor) { return Entry{*this, executor}; }
+
+        BulkheadStatistics getStatistics()
+        {
+            std::lock_guard lock{_mutex};
+            return {_inFlight, static_cast<uint32_t>(_queue.size()), _rejected, _timedOut};
+        }
+
+      private:
+        // false when caller should continue without suspending (admitted or rejected). Waiters of inline executor
+        // are rejected, expired ones would otherwise continue their requests on shared timer thread
+        bool enqueue(Entry &entry)
+        {
+            std::lock_guard lock{_mutex};
+            if (_inFlight < _options.maxConcurrency)
+            {
+                ++_inFlight;
+                entry._admitted = true;
+                return false;
+            }
+            if (_queue.size() < _options.maxQueue && !entry._executor.postsInline())
+            {
+                _queue.push_back(&entry);
+                if (!_timerRunning)
+                {
+                    _timerRunning = true;
+                    _timer = SharedTimer::getInstance().start(entry._deadline, [this] { return expire(); });
+                }
+                return true;
+            }
+            ++_rejected;
+            return false;
+        }
+
+        // slot is handed directly to first waiter, so it can not be taken by newcomers
+        void leave()
+        {
+            std::vector<Entry *> ready;
+            {
+                std::lock_guard lock{_mutex};
+                removeExpired(ready);
+                if (_queue.empty())
+                {
+                    --_inFlight;
+                }
+                else
+                {
+                    auto next = _queue.front();
+                    _queue.pop_front();
+                    next->_admitted = true;
+                    ready.push_back(next);
+                }
+            }
+            resume(ready);
+        }
+
+        void removeExpired(std::vector<Entry *> &expired)
+        {
+            auto now = Clock::now();
+            while (!_queue.empty() && _queue.front()->_deadline <= now)
+            {
+                expired.push_back(_queue.front());
+                _queue.pop_front();
+                ++_timedOut;
+            }
+        }
+
+        // queue timeout is same for all waiters, so first waiter expires first and timer is set to its deadline
+        std::optional<Clock::time_point> expire()
+        {
+            std::vector<Entry *> expired;
+            std::optional<Clock::time_point> next;
+            {
+                std::lock_guard lock{_mutex};
+                removeExpired(expired);
+                if (_queue.empty())
+                {
+                    _timerRunning = false;
+                }
+                else
+                {
+                    next = _queue.front()->_deadline;
+                }
+            }
+            resume(expired);
+            return next;
+        }
+
+        static void resume(const std::vector<Entry *> &entries)
+        {
+            for (auto entry : entries)
+            {
+                entry->_executor.post(entry->_handle);
+            }
+        }
+    };
+} // namespace sd
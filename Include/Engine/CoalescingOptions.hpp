@@ -0,0 +1,13 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace sd
+{
+    struct CoalescingOptions
+    {
+        // request headers responses depend on (for example Accept-Language), they become part of the request key
+        std::vector<std::string> varyByHeaders;
+    };
+} // namespace sd
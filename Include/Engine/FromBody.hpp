@@ -1,5 +1,8 @@
 #pragma once
 
+#include <exception>
+#include <optional>
+
 #include "Common/Json.hpp"
 #include "Common/Utils.hpp"
 #include "Engine/BaseParam.hpp"
@@ -14,18 +17,28 @@ namespace sd
     template <class T> class FromBody : public BaseParam
     {
       private:
-        T _value;
+        std::optional<T> _value;
 
       public:
-        FromBody(IContext &ctx) : BaseParam(ctx), _value(getJson(ctx).template as<T>()) {}
+        FromBody(IContext &ctx) : BaseParam(ctx)
+        {
+            try
+            {
+                _value.emplace(getJson(ctx).template as<T>());
+            }
+            catch (const std::exception &)
+            {
+                fail("body", "The value has invalid format.");
+            }
+        }
 
         T &operator*() { return get(); }
 
         const T &operator*() const { return get(); }
 
-        T &get() { return _value; }
+        T &get() { return *_value; }
 
-        const T &get() const { return _value; }
+        const T &get() const { return *_value; }
 
       private:
         Json getJson(IContext &ctx) { return tao::json::basic_from_string<JsonTraits>(ctx.getRequest().getBody()); }
@@ -37,7 +50,17 @@ namespace sd
         Json _value;
 
       public:
-        FromBody(IContext &ctx) : BaseParam(ctx), _value(getJson(ctx)) {}
+        FromBody(IContext &ctx) : BaseParam(ctx)
+        {
+            try
+            {
+                _value = getJson(ctx);
+            }
+            catch (const std::exception &)
+            {
+                fail("body", "The value has invalid format.");
+            }
+        }
 
         Json &operator*() { return get(); }
 
@@ -51,13 +74,14 @@ namespace sd
         Json getJson(IContext &ctx) { return tao::json::basic_from_string<JsonTraits>(ctx.getRequest().getBody()); }
     };
 
+    // Body is moved out of the request, later getBody() calls return empty view
     template <> class FromBody<std::string> : public BaseParam
     {
       private:
         std::string _value;
 
       public:
-        FromBody(IContext &ctx) : BaseParam(ctx), _value(ctx.getRequest().getBody()) {}
+        FromBody(IContext &ctx) : BaseParam(ctx), _value(ctx.getRequest().takeBody()) {}
 
         std::string &operator*() { return get(); }
 
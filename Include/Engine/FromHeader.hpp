@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string_view>
+
 #include "Common/Utils.hpp"
 #include "Engine/BaseParam.hpp"
 #include "Engine/IContext.hpp"
@@ -16,25 +18,10 @@ namespace sd
         FromHeader(IContext &ctx) : BaseParam(ctx)
         {
             static_assert(utils::IsSimpleTypeV<T>, "Please use int, bool, float, double or string");
-            if constexpr (utils::IsOptionalV<T>)
-            {
-                if (auto param = ctx.getRequest().getHeaders().get(getName()))
-                {
-                    _value = utils::convert<typename T::value_type>(std::string{*param});
-                }
-            }
-            else
-            {
-                auto param = ctx.getRequest().getHeaders().getRequired(getName());
-                _value = utils::convert<T>(std::string{param});
-            }
+            bind(getName(), ctx.getRequest().getHeaders().get(getName()), _value);
         }
 
-        std::string getName() const
-        {
-            constexpr auto contents = lit.value;
-            return {contents};
-        }
+        static constexpr std::string_view getName() { return lit.view(); }
 
         T &operator*() { return get(); }
 
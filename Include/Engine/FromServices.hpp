@@ -10,7 +10,7 @@
 
 namespace sd
 {
-    template <class T> class FromServices : BaseParam
+    template <class T> class FromServices : public BaseParam
     {
       private:
         T &_service;
@@ -27,7 +27,7 @@ namespace sd
         const T &get() const { return _service; }
     };
 
-    template <class T> class FromServices<std::unique_ptr<T>> : BaseParam
+    template <class T> class FromServices<std::unique_ptr<T>> : public BaseParam
     {
       private:
         std::unique_ptr<T> _service;
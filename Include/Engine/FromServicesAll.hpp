@@ -10,7 +10,7 @@
 
 namespace sd
 {
-    template <class T> class FromServicesAll : BaseParam
+    template <class T> class FromServicesAll : public BaseParam
     {
       private:
         std::vector<T *> _services;
@@ -29,7 +29,7 @@ namespace sd
         const std::vector<T *> &get() const { return _services; }
     };
 
-    template <class T> class FromServicesAll<std::vector<std::unique_ptr<T>>> : BaseParam
+    template <class T> class FromServicesAll<std::vector<std::unique_ptr<T>>> : public BaseParam
     {
       private:
         std::vector<std::unique_ptr<T>> _services;
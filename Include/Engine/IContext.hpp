@@ -3,6 +3,8 @@
 #include <memory>
 
 #include "Claims/ClaimsPrincipal.hpp"
+#include "Common/IExecutor.hpp"
+#include "Common/Task.hpp"
 #include "Data/IDataContainer.hpp"
 #include "Engine/IRoutingData.hpp"
 
@@ -27,6 +29,8 @@ namespace sd
 
         virtual const IRequest &getRequest() const = 0;
 
+        virtual IRequest &getRequest() = 0;
+
         // RequestAborted
 
         virtual ServiceProvider &getRequestServices() = 0;
@@ -47,6 +51,18 @@ namespace sd
 
         virtual void setUser(ClaimsPrincipal::Ptr user) = 0;
 
+        // False when no user was set or none of its identities is authenticated
+        virtual bool isAuthenticated() const = 0;
+
+        // Asynchronous part of request handling (for example async endpoint), awaited before response is sent.
+        // Setting continuation when one is already pending runs both in order
+        virtual void setContinuation(Task<> continuation) = 0;
+
+        virtual Task<> takeContinuation() = 0;
+
+        // Threads handling requests, work resumed from other threads should be posted to it
+        virtual IExecutor &getExecutor() = 0;
+
         // WebSockets
 
         virtual ~IContext() = default;
@@ -5,6 +5,11 @@
 #include <string>
 #include <vector>
 
+#include "Engine/Action.hpp"
+#include "Engine/Bulkhead.hpp"
+#include "Engine/CoalescingOptions.hpp"
+#include "Engine/OutputCachePolicy.hpp"
+#include "Engine/RequestPriority.hpp"
 #include "Http/HttpMethod.hpp"
 #include "Router/RouteTemplateSegments.hpp"
 
@@ -18,11 +23,31 @@ namespace sd
     {
         using Ptr = std::unique_ptr<IEndpoint>;
 
-        virtual void addPreTask() = 0;
+        virtual void addPreTask(PreTask task) = 0;
 
         virtual void addAuthorization(std::unique_ptr<IAuthorizer> authorizer) = 0;
 
-        virtual void addPostTask() = 0;
+        virtual void addPostTask(PostTask task) = 0;
+
+        // identical concurrent GET and HEAD requests share single action execution and its response. Requests with
+        // credentials (Authorization, Cookie) are coalesced only when options vary by that header
+        virtual void useCoalescing(CoalescingOptions options = {}) = 0;
+
+        // successful responses are stored by output cache middleware, if it is used. Hits are served before endpoint
+        // runs, so it can not be combined with authorizers or pre tasks
+        virtual void cacheOutput(OutputCachePolicy policy = {}) = 0;
+
+        virtual const OutputCachePolicy::Ptr &getOutputCachePolicy() const = 0;
+
+        // used by concurrency limiter middleware when shedding load
+        virtual void setPriority(RequestPriority priority) = 0;
+
+        virtual RequestPriority getPriority() const = 0;
+
+        // limits concurrent executions, endpoints sharing bulkhead share its quota
+        virtual void useBulkhead(Bulkhead::Ptr bulkhead) = 0;
+
+        void useBulkhead(BulkheadOptions options) { useBulkhead(std::make_shared<Bulkhead>(options)); }
 
         virtual HttpMethod getHttpMethod() const = 0;
 
@@ -30,6 +55,9 @@ namespace sd
 
         virtual const RouteTemplateSegments &getRouteTemplateSegments() const = 0;
 
+        // prepares execution plan, called once all filters are added
+        virtual void compile() = 0;
+
         virtual void executeAction(IContext &ctx) const = 0;
 
         virtual const std::vector<std::unique_ptr<IAuthorizer>> &getAuthorization() const = 0;
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "Engine/IEndpoint.hpp"
 #include "Http/IRouteParamsView.hpp"
+#include "Router/RouteMatch.hpp"
 
 namespace sd
 {
@@ -15,6 +17,9 @@ namespace sd
 
         virtual void setEndpoint(const IEndpoint *endpoint) = 0;
 
+        // path is owned by routing data, match values are offsets into it
+        virtual void setMatch(std::string path, const RouteMatch &match) = 0;
+
         virtual const IRouteParamsView &getRouteParams() const = 0;
 
         virtual ~IRoutingData() = default;
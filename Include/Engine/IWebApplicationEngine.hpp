@@ -4,12 +4,17 @@
 #include <string_view>
 #include <typeindex>
 
+#include "Common/ArenaStatistics.hpp"
 #include "Common/Export.hpp"
 #include "Configuration/IConfiguration.hpp"
 #include "DI/ServiceProvider.hpp"
 #include "Engine/Action.hpp"
+#include "Engine/BatchOptions.hpp"
 #include "Engine/EngineDependencies.hpp"
 #include "Engine/IEndpoint.hpp"
+#include "Http/HeaderBlock.hpp"
+#include "Http/TestRequest.hpp"
+#include "Http/TestResponse.hpp"
 #include "Log/ILogger.hpp"
 #include "Middlewares/MiddlewareCreator.hpp"
 #include "Router/IRouter.hpp"
@@ -29,12 +34,20 @@ namespace sd
 
         virtual void stop() = 0;
 
+        virtual void reloadCertificates() = 0;
+
+        virtual TestResponse handle(const TestRequest &request) = 0;
+
         virtual IEndpoint *map(HttpMethod method, std::string_view path, Action action) = 0;
 
+        virtual IEndpoint *mapBatch(std::string_view path, BatchOptions options) = 0;
+
         virtual void useAsFirst(IMiddlewareCreator::Ptr middleware) = 0;
 
         virtual void use(IMiddlewareCreator::Ptr middleware) = 0;
 
+        virtual void useHeaders(HeaderBlock::Ptr headers) = 0;
+
         virtual void useRouter() = 0;
 
         virtual void useEndpoints() = 0;
@@ -47,6 +60,10 @@ namespace sd
 
         virtual ServiceProvider &getServiceProvider() = 0;
 
+        virtual IRouter &getRouter() = 0;
+
+        virtual ArenaStatistics getArenaStatistics() const = 0;
+
         virtual ~IWebApplicationEngine() = default;
     };
 
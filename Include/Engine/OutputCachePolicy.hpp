@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sd
+{
+    struct OutputCachePolicy
+    {
+        // shared by endpoint and cache entries, so entries stay valid when cache outlives application
+        using Ptr = std::shared_ptr<const OutputCachePolicy>;
+
+        std::chrono::milliseconds duration = std::chrono::seconds{60};
+
+        // query parameters that become part of the cache key, whole query string is used when empty
+        std::vector<std::string> varyByQuery = {};
+
+        // request headers responses depend on (for example Accept-Language)
+        std::vector<std::string> varyByHeaders = {};
+
+        // names used to evict entries with OutputCache::evictByTag
+        std::vector<std::string> tags = {};
+
+        // bigger responses are not cached
+        size_t maxEntrySize = 1024 * 1024;
+    };
+} // namespace sd
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace sd
+{
+    // Order in which requests are shed under overload
+    enum class RequestPriority
+    {
+        Critical, // never shed (health checks, control routes)
+        Normal,
+        Sheddable // shed first, before limit is reached
+    };
+} // namespace sd
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Engine/WebApplication.hpp"
+#include "Http/HeaderBlock.hpp"
+#include "Http/HttpMethod.hpp"
+#include "Http/TestRequest.hpp"
+#include "Http/TestResponse.hpp"
+
+namespace sd
+{
+    // Sends requests straight to application pipeline (middlewares, router, endpoints) without sockets, for tests
+    // and benchmarks. Application is initialized on first request, it can not be configured after that
+    class TestServer
+    {
+      private:
+        WebApplication &_app;
+
+      public:
+        explicit TestServer(WebApplication &app) : _app(app) {}
+
+        TestResponse send(const TestRequest &request) { return _app.handle(request); }
+
+        TestResponse get(std::string target, std::vector<HeaderBlock::Field> headers = {})
+        {
+            return send({.method = HttpMethod::Get, .target = std::move(target), .headers = std::move(headers)});
+        }
+
+        TestResponse post(std::string target, std::string body, std::string contentType = "application/json")
+        {
+            return send(withBody(HttpMethod::Post, std::move(target), std::move(body), std::move(contentType)));
+        }
+
+        TestResponse put(std::string target, std::string body, std::string contentType = "application/json")
+        {
+            return send(withBody(HttpMethod::Put, std::move(target), std::move(body), std::move(contentType)));
+        }
+
+        TestResponse remove(std::string target)
+        {
+            return send({.method = HttpMethod::Delete, .target = std::move(target)});
+        }
+
+      private:
+        static TestRequest withBody(HttpMethod method, std::string target, std::string body, std::string contentType)
+        {
+            return {.method = method,
+                    .target = std::move(target),
+                    .headers = {{"Content-Type", std::move(contentType)}},
+                    .body = std::move(body)};
+        }
+    };
+} // namespace sd
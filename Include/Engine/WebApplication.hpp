@@ -4,7 +4,10 @@
 #include <optional>
 #include <string>
 #include <tao/json/forward.hpp>
+#include <tuple>
+#include <type_traits>
 
+#include "Common/Task.hpp"
 #include "Common/Utils.hpp"
 #include "DI/ServiceProvider.hpp"
 #include "Engine/FromBody.hpp"
@@ -16,15 +19,24 @@
 #include "Engine/IContext.hpp"
 #include "Engine/IEndpoint.hpp"
 #include "Engine/IWebApplicationEngine.hpp"
+#include "Http/HeaderBlock.hpp"
 #include "Http/HttpMethod.hpp"
 #include "Http/IRequest.hpp"
 #include "Http/IResponse.hpp"
 #include "Http/IResult.hpp"
 #include "Http/Results.hpp"
+#include "Http/TestRequest.hpp"
+#include "Http/TestResponse.hpp"
+#include "Middlewares/ConcurrencyLimiterMiddleware.hpp"
+#include "Middlewares/ETagMiddleware.hpp"
+#include "Middlewares/EndpointsMiddleware.hpp"
 #include "Middlewares/IMiddleware.hpp"
 #include "Middlewares/MiddlewareCreator.hpp"
 #include "Middlewares/MiddlewareLambdaCreator.hpp"
-#include "Middlewares/SetupMiddleware.hpp"
+#include "Middlewares/OutputCacheMiddleware.hpp"
+#include "Middlewares/RateLimiterMiddleware.hpp"
+#include "Middlewares/RouterMiddleware.hpp"
+#include "Middlewares/StaticPipeline.hpp"
 #include "Router/Constrains.hpp"
 #include "Router/IRouter.hpp"
 #include "Services/Environment.hpp"
@@ -62,27 +74,27 @@ namespace sd
 
         template <class Lambda> IEndpoint *mapPut(std::string_view path, Lambda &&action)
         {
-            return _engine->map(HttpMethod::Put, createAction(action, &Lambda::operator()));
+            return _engine->map(HttpMethod::Put, path, createAction(action, &Lambda::operator()));
         }
 
         template <class Lambda> IEndpoint *mapPatch(std::string_view path, Lambda &&action)
         {
-            return _engine->map(HttpMethod::Patch, createAction(action, &Lambda::operator()));
+            return _engine->map(HttpMethod::Patch, path, createAction(action, &Lambda::operator()));
         }
 
         template <class Lambda> IEndpoint *mapPost(std::string_view path, Lambda &&action)
         {
-            return _engine->map(HttpMethod::Post, createAction(action, &Lambda::operator()));
+            return _engine->map(HttpMethod::Post, path, createAction(action, &Lambda::operator()));
         }
 
         template <class Lambda> IEndpoint *mapDelete(std::string_view path, Lambda &&action)
         {
-            return _engine->map(HttpMethod::Delete, createAction(action, &Lambda::operator()));
+            return _engine->map(HttpMethod::Delete, path, createAction(action, &Lambda::operator()));
         }
 
         template <class Lambda> IEndpoint *mapHead(std::string_view path, Lambda &&action)
         {
-            return _engine->map(HttpMethod::Head, createAction(action, &Lambda::operator()));
+            return _engine->map(HttpMethod::Head, path, createAction(action, &Lambda::operator()));
         }
 
         void run(std::optional<std::string> url = std::nullopt, int threadsNumber = -1)
@@ -93,17 +105,93 @@ namespace sd
 
         void stop() { _engine->stop(); }
 
+        // Runs request through the whole pipeline in process and waits for response, no server is started.
+        // Application is initialized on first call, see TestServer
+        TestResponse handle(const TestRequest &request)
+        {
+            init();
+            return _engine->handle(request);
+        }
+
+        // Loads certificate and private key files again, can be called from any thread while server is running
+        void reloadCertificates() { _engine->reloadCertificates(); }
+
+        // POST endpoint running array of sub-requests through the pipeline in one round trip, see BatchHandler
+        IEndpoint *mapBatch(std::string_view path = "/batch", BatchOptions options = {})
+        {
+            return _engine->mapBatch(path, options);
+        }
+
         void useRouter() { _engine->useRouter(); }
 
         void useEndpoints() { _engine->useEndpoints(); }
 
+        void useHeaders(HeaderBlock headers) { _engine->useHeaders(std::make_shared<HeaderBlock>(std::move(headers))); }
+
+        // Bulkhead for group of endpoints, options are read from configuration section bulkheads.<name> if present,
+        // for example app.mapGet(...)->useBulkhead(app.createBulkhead("reports"))
+        Bulkhead::Ptr createBulkhead(const std::string &name, BulkheadOptions defaults = {})
+        {
+            auto section = getConfiguration().find("bulkheads");
+            auto options = BulkheadOptions::fromJson(section && section->is_object() ? section->find(name) : nullptr,
+                                                     std::move(defaults));
+            return std::make_shared<Bulkhead>(options);
+        }
+
+        // Sheds requests with 503 when latency grows, endpoint priorities are used so call it after useRouter()
+        void useConcurrencyLimiter(ConcurrencyLimitOptions options = {})
+        {
+            _engine->use(std::make_unique<ConcurrencyLimiterMiddlewareCreator>(options));
+        }
+
+        // Rejects requests over the limit with 429, can be used several times with different partitions.
+        // Used before useRouter() route partition falls back to request path
+        void useRateLimiter(RateLimitPolicy policy = {})
+        {
+            _engine->use(std::make_unique<RateLimiterMiddlewareCreator>(std::move(policy)));
+        }
+
+        // Adds ETag to successful GET responses and answers If-None-Match with 304, use before useOutputCache()
+        void useETags() { _engine->use(std::make_unique<ETagMiddlewareCreator>()); }
+
+        // Stores responses of endpoints marked with cacheOutput, used before useRouter() hits skip routing.
+        // Returned cache can be used to evict entries by tag
+        OutputCache::Ptr useOutputCache(OutputCacheOptions options = {})
+        {
+            auto cache = std::make_shared<OutputCache>(options);
+            _engine->use(std::make_unique<OutputCacheMiddlewareCreator>(cache));
+            return cache;
+        }
+
+        // Middleware is created for each request
         template <class MiddlewareT> void use() { _engine->use(std::make_unique<MiddlewareCreator<MiddlewareT>>()); }
 
+        // Middleware is created once and shared by all requests, it must be thread safe
+        template <class MiddlewareT> void useSingleton()
+        {
+            _engine->use(std::make_unique<MiddlewareCreator<MiddlewareT, MiddlewareLifetime::Singleton>>());
+        }
+
+        // Middlewares composed at compile time into one singleton middleware, for example
+        // usePipeline<RouterMiddleware, CorsMiddleware, EndpointsMiddleware>().
+        // Middlewares constructible from IRouter * receive application router, others are default constructed
+        template <class... MiddlewaresT> void usePipeline()
+        {
+            _engine->use(std::make_unique<StaticPipelineCreator<MiddlewaresT...>>(&_engine->getRouter()));
+        }
+
+        // Lambda is copied for each request
         template <class Lambda> void use(Lambda lambda)
         {
             _engine->use(std::make_unique<MiddlewareLambdaCreator<Lambda>>(lambda));
         }
 
+        // Lambda is shared by all requests without copying, captured state must be thread safe
+        template <class Lambda> void useSingleton(Lambda lambda)
+        {
+            _engine->use(std::make_unique<MiddlewareLambdaCreator<Lambda, MiddlewareLifetime::Singleton>>(lambda));
+        }
+
         const IConfiguration &getConfiguration() { return _engine->getConfiguration(); }
 
         const IEnvironment &getEnvironment() { return _engine->getEnvironment(); }
@@ -112,41 +200,107 @@ namespace sd
 
         ServiceProvider &getServiceProvider() { return _engine->getServiceProvider(); }
 
+        ArenaStatistics getArenaStatistics() const { return _engine->getArenaStatistics(); }
+
         ~WebApplication() = default;
 
       private:
         void init()
         {
             _engine->init();
-            _engine->useAsFirst(std::make_unique<MiddlewareCreator<SetupMiddleware>>());
         }
 
-        template <class Lambda, class... Args> auto createAction(Lambda lambda, std::string (Lambda::*)(Args...) const)
+        template <class Lambda, class Res, class... Args>
+        auto createAction(Lambda lambda, Res (Lambda::*)(Args...) const)
         {
             return [lambda = std::move(lambda)](IContext &ctx) {
-                TextResult textResult{lambda(getArg<Args>(ctx)...), "text/plain; charset=utf-8"};
-                textResult.execute(ctx.getResponse());
+                std::tuple<Args...> args{getArg<Args>(ctx)...};
+                if (!checkBinding(ctx, args))
+                {
+                    return;
+                }
+                if constexpr (std::is_void_v<Res>)
+                {
+                    std::apply(lambda, std::move(args));
+                }
+                else
+                {
+                    writeResult(ctx, std::apply(lambda, std::move(args)));
+                }
             };
         }
 
-        template <class Lambda, class... Args> auto createAction(Lambda lambda, IResult::Ptr (Lambda::*)(Args...) const)
+        // Lambda returning Task runs as request continuation, bound parameters live in its frame until it completes
+        template <class Lambda, class Res, class... Args>
+        auto createAction(Lambda lambda, Task<Res> (Lambda::*)(Args...) const)
         {
             return [lambda = std::move(lambda)](IContext &ctx) {
-                if (IResult::Ptr result = lambda(getArg<Args>(ctx)...))
+                std::tuple<Args...> args{getArg<Args>(ctx)...};
+                if (checkBinding(ctx, args))
                 {
-                    result->execute(ctx.getResponse());
+                    ctx.setContinuation(invokeAsync<Res>(lambda, ctx, std::move(args)));
                 }
-                // todo throw exception null
             };
         }
 
-        template <class Lambda, class Res, class... Args>
-        auto createAction(Lambda lambda, Res (Lambda::*)(Args...) const)
+        template <class Res, class Lambda, class... Args>
+        static Task<> invokeAsync(const Lambda &lambda, IContext &ctx, std::tuple<Args...> args)
         {
-            return [lambda = std::move(lambda)](IContext &ctx) {
-                OkResult okResult{lambda(getArg<Args>(ctx)...)};
-                okResult.execute(ctx.getResponse());
+            if constexpr (std::is_void_v<Res>)
+            {
+                co_await std::apply(lambda, std::move(args));
+            }
+            else
+            {
+                writeResult(ctx, co_await std::apply(lambda, std::move(args)));
+            }
+        }
+
+        static void writeResult(IContext &ctx, std::string value)
+        {
+            TextResult{std::move(value), "text/plain; charset=utf-8"}.execute(ctx.getResponse());
+        }
+
+        static void writeResult(IContext &ctx, IResult::Ptr result)
+        {
+            if (result)
+            {
+                result->execute(ctx.getResponse());
+            }
+            // todo throw exception null
+        }
+
+        template <class Res> static void writeResult(IContext &ctx, Res value)
+        {
+            OkResult{std::move(value)}.execute(ctx.getResponse());
+        }
+
+        template <class T> static const BindingError *getBindingError(const T &arg)
+        {
+            if constexpr (std::is_base_of_v<BaseParam, std::decay_t<T>>)
+            {
+                return arg.isBound() ? nullptr : &arg.getError();
+            }
+            return nullptr;
+        }
+
+        // Responds with 400 validation problem listing parameters that failed to bind, handler is not invoked then
+        template <class... Args> static bool checkBinding(IContext &ctx, const std::tuple<Args...> &args)
+        {
+            sd::Json errors;
+            auto addError = [&errors](const BindingError *error) {
+                if (error)
+                {
+                    errors[std::string{error->name}] = sd::Json::array({error->reason});
+                }
             };
+            std::apply([&](const auto &...arg) { (addError(getBindingError(arg)), ...); }, args);
+            if (errors.is_uninitialized())
+            {
+                return true;
+            }
+            ValidationProblemResult{errors}.execute(ctx.getResponse());
+            return false;
         }
     };
 
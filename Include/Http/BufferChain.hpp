@@ -0,0 +1,114 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace sd
+{
+    // Response body made of independent segments, segments are written with one gathered write without being
+    // concatenated first
+    class BufferChain final
+    {
+      private:
+        using Segment = std::variant<std::string, std::shared_ptr<const std::string>, std::string_view>;
+
+        std::vector<Segment> _segments;
+        size_t _size = 0;
+
+      public:
+        BufferChain() = default;
+        BufferChain(std::string data) { append(std::move(data)); }
+
+        BufferChain(BufferChain &&) = default;
+        BufferChain(const BufferChain &) = default;
+        BufferChain &operator=(BufferChain &&) = default;
+        BufferChain &operator=(const BufferChain &) = default;
+
+        // takes ownership of data
+        void append(std::string data)
+        {
+            if (!data.empty())
+            {
+                _size += data.size();
+                _segments.emplace_back(std::move(data));
+            }
+        }
+
+        // shares data with other owners (for example caches) without copying it
+        void append(std::shared_ptr<const std::string> data)
+        {
+            if (data && !data->empty())
+            {
+                _size += data->size();
+                _segments.emplace_back(std::move(data));
+            }
+        }
+
+        // data is not copied, it must outlive the response (string literals, static buffers)
+        void appendStatic(std::string_view data)
+        {
+            if (!data.empty())
+            {
+                _size += data.size();
+                _segments.emplace_back(data);
+            }
+        }
+
+        void append(BufferChain other)
+        {
+            _size += other._size;
+            _segments.reserve(_segments.size() + other._segments.size());
+            for (auto &segment : other._segments)
+            {
+                _segments.push_back(std::move(segment));
+            }
+        }
+
+        void reserve(size_t segments) { _segments.reserve(segments); }
+
+        size_t size() const { return _size; }
+
+        bool empty() const { return _size == 0; }
+
+        size_t segmentsCount() const { return _segments.size(); }
+
+        void clear()
+        {
+            _segments.clear();
+            _size = 0;
+        }
+
+        template <class Fcn> void forEach(Fcn fcn) const
+        {
+            for (auto &segment : _segments)
+            {
+                fcn(view(segment));
+            }
+        }
+
+        std::string toString() const
+        {
+            std::string result;
+            result.reserve(_size);
+            forEach([&](std::string_view segment) { result.append(segment); });
+            return result;
+        }
+
+      private:
+        static std::string_view view(const Segment &segment)
+        {
+            if (auto owned = std::get_if<std::string>(&segment))
+            {
+                return *owned;
+            }
+            if (auto shared = std::get_if<std::shared_ptr<const std::string>>(&segment))
+            {
+                return **shared;
+            }
+            return std::get<std::string_view>(segment);
+        }
+    };
+} // namespace sd
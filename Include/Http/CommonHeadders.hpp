@@ -1,6 +1,6 @@
 #pragma once
 
-#include <string>
+#include <string_view>
 
 namespace sd
 {
@@ -8,189 +8,189 @@ namespace sd
     {
         // Adopted header fields
         // (https://www.iana.org/assignments/message-headers/message-headers.xml#perm-headers).
-        const std::string a_im = "A-IM";
-        const std::string accept = "Accept";
-        const std::string accept_additions = "Accept-Additions";
-        const std::string accept_charset = "Accept-Charset";
-        const std::string accept_datetime = "Accept-Datetime";
-        const std::string accept_encoding = "Accept-Encoding";
-        const std::string accept_features = "Accept-Features";
-        const std::string accept_language = "Accept-Language";
-        const std::string accept_patch = "Accept-Patch";
-        const std::string accept_post = "Accept-Post";
-        const std::string accept_ranges = "Accept-Ranges";
-        const std::string age = "Age";
-        const std::string allow = "Allow";
-        const std::string alpn = "ALPN";
-        const std::string alt_svc = "Alt-Svc";
-        const std::string alt_used = "Alt-Used";
-        const std::string alternates = "Alternates";
-        const std::string apply_to_redirect_ref = "Apply-To-Redirect-Ref";
-        const std::string authentication_control = "Authentication-Control";
-        const std::string authentication_info = "Authentication-Info";
-        const std::string authorization = "Authorization";
-        const std::string c_ext = "C-Ext";
-        const std::string c_man = "C-Man";
-        const std::string c_opt = "C-Opt";
-        const std::string c_pep = "C-PEP";
-        const std::string c_pep_info = "C-PEP-Info";
-        const std::string cache_control = "Cache-Control";
-        const std::string caldav_timezones = "CalDAV-Timezones";
-        const std::string close = "Close";
-        const std::string content_base = "Content-Base";
-        const std::string content_disposition = "Content-Disposition";
-        const std::string content_encoding = "Content-Encoding";
-        const std::string content_id = "Content-ID";
-        const std::string content_language = "Content-Language";
-        const std::string content_location = "Content-Location";
-        const std::string content_md5 = "Content-MD5";
-        const std::string content_range = "Content-Range";
-        const std::string content_script_type = "Content-Script-Type";
-        const std::string content_style_type = "Content-Style-Type";
-        const std::string content_type = "Content-Type";
-        const std::string content_version = "Content-Version";
-        const std::string cookie = "Cookie";
-        const std::string cookie2 = "Cookie2";
-        const std::string dasl = "DASL";
-        const std::string dav = "DAV";
-        const std::string date = "Date";
-        const std::string default_style = "Default-Style";
-        const std::string delta_base = "Delta-Base";
-        const std::string depth = "Depth";
-        const std::string derived_from = "Derived-From";
-        const std::string destination = "Destination";
-        const std::string differential_id = "Differential-ID";
-        const std::string digest = "Digest";
-        const std::string etag = "ETag";
-        const std::string expect = "Expect";
-        const std::string expires = "Expires";
-        const std::string ext = "Ext";
-        const std::string forwarded = "Forwarded";
-        const std::string from = "From";
-        const std::string getprofile = "GetProfile";
-        const std::string hobareg = "Hobareg";
-        const std::string host = "Host";
-        const std::string http2_settings = "HTTP2-Settings";
-        const std::string im = "IM";
-        const std::string if_ = "If";
-        const std::string if_match = "If-Match";
-        const std::string if_modified_since = "If-Modified-Since";
-        const std::string if_none_match = "If-None-Match";
-        const std::string if_range = "If-Range";
-        const std::string if_schedule_tag_match = "If-Schedule-Tag-Match";
-        const std::string if_unmodified_since = "If-Unmodified-Since";
-        const std::string keep_alive = "Keep-Alive";
-        const std::string label = "Label";
-        const std::string last_modified = "Last-Modified";
-        const std::string link = "Link";
-        const std::string location = "Location";
-        const std::string lock_token = "Lock-Token";
-        const std::string man = "Man";
-        const std::string max_forwards = "Max-Forwards";
-        const std::string memento_datetime = "Memento-Datetime";
-        const std::string meter = "Meter";
-        const std::string mime_version = "MIME-Version";
-        const std::string negotiate = "Negotiate";
-        const std::string opt = "Opt";
-        const std::string optional_www_authenticate = "Optional-WWW-Authenticate";
-        const std::string ordering_type = "Ordering-Type";
-        const std::string origin = "Origin";
-        const std::string overwrite = "Overwrite";
-        const std::string p3p = "P3P";
-        const std::string pep = "PEP";
-        const std::string pics_label = "PICS-Label";
-        const std::string pep_info = "Pep-Info";
-        const std::string position = "Position";
-        const std::string pragma = "Pragma";
-        const std::string prefer = "Prefer";
-        const std::string preference_applied = "Preference-Applied";
-        const std::string profileobject = "ProfileObject";
-        const std::string protocol = "Protocol";
-        const std::string protocol_info = "Protocol-Info";
-        const std::string protocol_query = "Protocol-Query";
-        const std::string protocol_request = "Protocol-Request";
-        const std::string proxy_authenticate = "Proxy-Authenticate";
-        const std::string proxy_authentication_info = "Proxy-Authentication-Info";
-        const std::string proxy_authorization = "Proxy-Authorization";
-        const std::string proxy_features = "Proxy-Features";
-        const std::string proxy_instruction = "Proxy-Instruction";
-        const std::string public_ = "Public";
-        const std::string public_key_pins = "Public-Key-Pins";
-        const std::string public_key_pins_report_only = "Public-Key-Pins-Report-Only";
-        const std::string range = "Range";
-        const std::string redirect_ref = "Redirect-Ref";
-        const std::string referer = "Referer";
-        const std::string retry_after = "Retry-After";
-        const std::string safe = "Safe";
-        const std::string schedule_reply = "Schedule-Reply";
-        const std::string schedule_tag = "Schedule-Tag";
-        const std::string sec_websocket_accept = "Sec-WebSocket-Accept";
-        const std::string sec_websocket_extensions = "Sec-WebSocket-Extensions";
-        const std::string sec_websocket_key = "Sec-WebSocket-Key";
-        const std::string sec_websocket_protocol = "Sec-WebSocket-Protocol";
-        const std::string sec_websocket_version = "Sec-WebSocket-Version";
-        const std::string security_scheme = "Security-Scheme";
-        const std::string server = "Server";
-        const std::string set_cookie = "Set-Cookie";
-        const std::string set_cookie2 = "Set-Cookie2";
-        const std::string setprofile = "SetProfile";
-        const std::string slug = "SLUG";
-        const std::string soapaction = "SoapAction";
-        const std::string status_uri = "Status-URI";
-        const std::string strict_transport_security = "Strict-Transport-Security";
-        const std::string surrogate_capability = "Surrogate-Capability";
-        const std::string surrogate_control = "Surrogate-Control";
-        const std::string tcn = "TCN";
-        const std::string te = "TE";
-        const std::string timeout = "Timeout";
-        const std::string topic = "Topic";
-        const std::string trailer = "Trailer";
-        const std::string transfer_encoding = "Transfer-Encoding";
-        const std::string ttl = "TTL";
-        const std::string urgency = "Urgency";
-        const std::string uri = "URI";
-        const std::string upgrade = "Upgrade";
-        const std::string user_agent = "User-Agent";
-        const std::string variant_vary = "Variant-Vary";
-        const std::string vary = "Vary";
-        const std::string via = "Via";
-        const std::string www_authenticate = "WWW-Authenticate";
-        const std::string want_digest = "Want-Digest";
-        const std::string warning = "Warning";
-        const std::string x_frame_options = "X-Frame-Options";
-        const std::string access_control = "Access-Control";
-        const std::string access_control_allow_credentials = "Access-Control-Allow-Credentials";
-        const std::string access_control_allow_headers = "Access-Control-Allow-Headers";
-        const std::string access_control_allow_methods = "Access-Control-Allow-Methods";
-        const std::string access_control_allow_origin = "Access-Control-Allow-Origin";
-        const std::string access_control_max_age = "Access-Control-Max-Age";
-        const std::string access_control_request_method = "Access-Control-Request-Method";
-        const std::string access_control_request_headers = "Access-Control-Request-Headers";
-        const std::string compliance = "Compliance";
-        const std::string content_transfer_encoding = "Content-Transfer-Encoding";
-        const std::string cost = "Cost";
-        const std::string ediint_features = "EDIINT-Features";
-        const std::string message_id = "Message-ID";
-        const std::string method_check = "Method-Check";
-        const std::string method_check_expires = "Method-Check-Expires";
-        const std::string non_compliance = "Non-Compliance";
-        const std::string optional = "Optional";
-        const std::string referer_root = "Referer-Root";
-        const std::string resolution_hint = "Resolution-Hint";
-        const std::string resolver_location = "Resolver-Location";
-        const std::string subok = "SubOK";
-        const std::string subst = "Subst";
-        const std::string title = "Title";
-        const std::string ua_color = "UA-Color";
-        const std::string ua_media = "UA-Media";
-        const std::string ua_pixels = "UA-Pixels";
-        const std::string ua_resolution = "UA-Resolution";
-        const std::string ua_windowpixels = "UA-Windowpixels";
-        const std::string version = "Version";
-        const std::string x_device_accept = "X-Device-Accept";
-        const std::string x_device_accept_charset = "X-Device-Accept-Charset";
-        const std::string x_device_accept_encoding = "X-Device-Accept-Encoding";
-        const std::string x_device_accept_language = "X-Device-Accept-Language";
-        const std::string x_device_user_agent = "X-Device-User-Agent";
+        inline constexpr std::string_view a_im = "A-IM";
+        inline constexpr std::string_view accept = "Accept";
+        inline constexpr std::string_view accept_additions = "Accept-Additions";
+        inline constexpr std::string_view accept_charset = "Accept-Charset";
+        inline constexpr std::string_view accept_datetime = "Accept-Datetime";
+        inline constexpr std::string_view accept_encoding = "Accept-Encoding";
+        inline constexpr std::string_view accept_features = "Accept-Features";
+        inline constexpr std::string_view accept_language = "Accept-Language";
+        inline constexpr std::string_view accept_patch = "Accept-Patch";
+        inline constexpr std::string_view accept_post = "Accept-Post";
+        inline constexpr std::string_view accept_ranges = "Accept-Ranges";
+        inline constexpr std::string_view age = "Age";
+        inline constexpr std::string_view allow = "Allow";
+        inline constexpr std::string_view alpn = "ALPN";
+        inline constexpr std::string_view alt_svc = "Alt-Svc";
+        inline constexpr std::string_view alt_used = "Alt-Used";
+        inline constexpr std::string_view alternates = "Alternates";
+        inline constexpr std::string_view apply_to_redirect_ref = "Apply-To-Redirect-Ref";
+        inline constexpr std::string_view authentication_control = "Authentication-Control";
+        inline constexpr std::string_view authentication_info = "Authentication-Info";
+        inline constexpr std::string_view authorization = "Authorization";
+        inline constexpr std::string_view c_ext = "C-Ext";
+        inline constexpr std::string_view c_man = "C-Man";
+        inline constexpr std::string_view c_opt = "C-Opt";
+        inline constexpr std::string_view c_pep = "C-PEP";
+        inline constexpr std::string_view c_pep_info = "C-PEP-Info";
+        inline constexpr std::string_view cache_control = "Cache-Control";
+        inline constexpr std::string_view caldav_timezones = "CalDAV-Timezones";
+        inline constexpr std::string_view close = "Close";
+        inline constexpr std::string_view content_base = "Content-Base";
+        inline constexpr std::string_view content_disposition = "Content-Disposition";
+        inline constexpr std::string_view content_encoding = "Content-Encoding";
+        inline constexpr std::string_view content_id = "Content-ID";
+        inline constexpr std::string_view content_language = "Content-Language";
+        inline constexpr std::string_view content_location = "Content-Location";
+        inline constexpr std::string_view content_md5 = "Content-MD5";
+        inline constexpr std::string_view content_range = "Content-Range";
+        inline constexpr std::string_view content_script_type = "Content-Script-Type";
+        inline constexpr std::string_view content_style_type = "Content-Style-Type";
+        inline constexpr std::string_view content_type = "Content-Type";
+        inline constexpr std::string_view content_version = "Content-Version";
+        inline constexpr std::string_view cookie = "Cookie";
+        inline constexpr std::string_view cookie2 = "Cookie2";
+        inline constexpr std::string_view dasl = "DASL";
+        inline constexpr std::string_view dav = "DAV";
+        inline constexpr std::string_view date = "Date";
+        inline constexpr std::string_view default_style = "Default-Style";
+        inline constexpr std::string_view delta_base = "Delta-Base";
+        inline constexpr std::string_view depth = "Depth";
+        inline constexpr std::string_view derived_from = "Derived-From";
+        inline constexpr std::string_view destination = "Destination";
+        inline constexpr std::string_view differential_id = "Differential-ID";
+        inline constexpr std::string_view digest = "Digest";
+        inline constexpr std::string_view etag = "ETag";
+        inline constexpr std::string_view expect = "Expect";
+        inline constexpr std::string_view expires = "Expires";
+        inline constexpr std::string_view ext = "Ext";
+        inline constexpr std::string_view forwarded = "Forwarded";
+        inline constexpr std::string_view from = "From";
+        inline constexpr std::string_view getprofile = "GetProfile";
+        inline constexpr std::string_view hobareg = "Hobareg";
+        inline constexpr std::string_view host = "Host";
+        inline constexpr std::string_view http2_settings = "HTTP2-Settings";
+        inline constexpr std::string_view im = "IM";
+        inline constexpr std::string_view if_ = "If";
+        inline constexpr std::string_view if_match = "If-Match";
+        inline constexpr std::string_view if_modified_since = "If-Modified-Since";
+        inline constexpr std::string_view if_none_match = "If-None-Match";
+        inline constexpr std::string_view if_range = "If-Range";
+        inline constexpr std::string_view if_schedule_tag_match = "If-Schedule-Tag-Match";
+        inline constexpr std::string_view if_unmodified_since = "If-Unmodified-Since";
+        inline constexpr std::string_view keep_alive = "Keep-Alive";
+        inline constexpr std::string_view label = "Label";
+        inline constexpr std::string_view last_modified = "Last-Modified";
+        inline constexpr std::string_view link = "Link";
+        inline constexpr std::string_view location = "Location";
+        inline constexpr std::string_view lock_token = "Lock-Token";
+        inline constexpr std::string_view man = "Man";
+        inline constexpr std::string_view max_forwards = "Max-Forwards";
+        inline constexpr std::string_view memento_datetime = "Memento-Datetime";
+        inline constexpr std::string_view meter = "Meter";
+        inline constexpr std::string_view mime_version = "MIME-Version";
+        inline constexpr std::string_view negotiate = "Negotiate";
+        inline constexpr std::string_view opt = "Opt";
+        inline constexpr std::string_view optional_www_authenticate = "Optional-WWW-Authenticate";
+        inline constexpr std::string_view ordering_type = "Ordering-Type";
+        inline constexpr std::string_view origin = "Origin";
+        inline constexpr std::string_view overwrite = "Overwrite";
+        inline constexpr std::string_view p3p = "P3P";
+        inline constexpr std::string_view pep = "PEP";
+        inline constexpr std::string_view pics_label = "PICS-Label";
+        inline constexpr std::string_view pep_info = "Pep-Info";
+        inline constexpr std::string_view position = "Position";
+        inline constexpr std::string_view pragma = "Pragma";
+        inline constexpr std::string_view prefer = "Prefer";
+        inline constexpr std::string_view preference_applied = "Preference-Applied";
+        inline constexpr std::string_view profileobject = "ProfileObject";
+        inline constexpr std::string_view protocol = "Protocol";
+        inline constexpr std::string_view protocol_info = "Protocol-Info";
+        inline constexpr std::string_view protocol_query = "Protocol-Query";
+        inline constexpr std::string_view protocol_request = "Protocol-Request";
+        inline constexpr std::string_view proxy_authenticate = "Proxy-Authenticate";
+        inline constexpr std::string_view proxy_authentication_info = "Proxy-Authentication-Info";
+        inline constexpr std::string_view proxy_authorization = "Proxy-Authorization";
+        inline constexpr std::string_view proxy_features = "Proxy-Features";
+        inline constexpr std::string_view proxy_instruction = "Proxy-Instruction";
+        inline constexpr std::string_view public_ = "Public";
+        inline constexpr std::string_view public_key_pins = "Public-Key-Pins";
+        inline constexpr std::string_view public_key_pins_report_only = "Public-Key-Pins-Report-Only";
+        inline constexpr std::string_view range = "Range";
+        inline constexpr std::string_view redirect_ref = "Redirect-Ref";
+        inline constexpr std::string_view referer = "Referer";
+        inline constexpr std::string_view retry_after = "Retry-After";
+        inline constexpr std::string_view safe = "Safe";
+        inline constexpr std::string_view schedule_reply = "Schedule-Reply";
+        inline constexpr std::string_view schedule_tag = "Schedule-Tag";
+        inline constexpr std::string_view sec_websocket_accept = "Sec-WebSocket-Accept";
+        inline constexpr std::string_view sec_websocket_extensions = "Sec-WebSocket-Extensions";
+        inline constexpr std::string_view sec_websocket_key = "Sec-WebSocket-Key";
+        inline constexpr std::string_view sec_websocket_protocol = "Sec-WebSocket-Protocol";
+        inline constexpr std::string_view sec_websocket_version = "Sec-WebSocket-Version";
+        inline constexpr std::string_view security_scheme = "Security-Scheme";
+        inline constexpr std::string_view server = "Server";
+        inline constexpr std::string_view set_cookie = "Set-Cookie";
+        inline constexpr std::string_view set_cookie2 = "Set-Cookie2";
+        inline constexpr std::string_view setprofile = "SetProfile";
+        inline constexpr std::string_view slug = "SLUG";
+        inline constexpr std::string_view soapaction = "SoapAction";
+        inline constexpr std::string_view status_uri = "Status-URI";
+        inline constexpr std::string_view strict_transport_security = "Strict-Transport-Security";
+        inline constexpr std::string_view surrogate_capability = "Surrogate-Capability";
+        inline constexpr std::string_view surrogate_control = "Surrogate-Control";
+        inline constexpr std::string_view tcn = "TCN";
+        inline constexpr std::string_view te = "TE";
+        inline constexpr std::string_view timeout = "Timeout";
+        inline constexpr std::string_view topic = "Topic";
+        inline constexpr std::string_view trailer = "Trailer";
+        inline constexpr std::string_view transfer_encoding = "Transfer-Encoding";
+        inline constexpr std::string_view ttl = "TTL";
+        inline constexpr std::string_view urgency = "Urgency";
+        inline constexpr std::string_view uri = "URI";
+        inline constexpr std::string_view upgrade = "Upgrade";
+        inline constexpr std::string_view user_agent = "User-Agent";
+        inline constexpr std::string_view variant_vary = "Variant-Vary";
+        inline constexpr std::string_view vary = "Vary";
+        inline constexpr std::string_view via = "Via";
+        inline constexpr std::string_view www_authenticate = "WWW-Authenticate";
+        inline constexpr std::string_view want_digest = "Want-Digest";
+        inline constexpr std::string_view warning = "Warning";
+        inline constexpr std::string_view x_frame_options = "X-Frame-Options";
+        inline constexpr std::string_view access_control = "Access-Control";
+        inline constexpr std::string_view access_control_allow_credentials = "Access-Control-Allow-Credentials";
+        inline constexpr std::string_view access_control_allow_headers = "Access-Control-Allow-Headers";
+        inline constexpr std::string_view access_control_allow_methods = "Access-Control-Allow-Methods";
+        inline constexpr std::string_view access_control_allow_origin = "Access-Control-Allow-Origin";
+        inline constexpr std::string_view access_control_max_age = "Access-Control-Max-Age";
+        inline constexpr std::string_view access_control_request_method = "Access-Control-Request-Method";
+        inline constexpr std::string_view access_control_request_headers = "Access-Control-Request-Headers";
+        inline constexpr std::string_view compliance = "Compliance";
+        inline constexpr std::string_view content_transfer_encoding = "Content-Transfer-Encoding";
+        inline constexpr std::string_view cost = "Cost";
+        inline constexpr std::string_view ediint_features = "EDIINT-Features";
+        inline constexpr std::string_view message_id = "Message-ID";
+        inline constexpr std::string_view method_check = "Method-Check";
+        inline constexpr std::string_view method_check_expires = "Method-Check-Expires";
+        inline constexpr std::string_view non_compliance = "Non-Compliance";
+        inline constexpr std::string_view optional = "Optional";
+        inline constexpr std::string_view referer_root = "Referer-Root";
+        inline constexpr std::string_view resolution_hint = "Resolution-Hint";
+        inline constexpr std::string_view resolver_location = "Resolver-Location";
+        inline constexpr std::string_view subok = "SubOK";
+        inline constexpr std::string_view subst = "Subst";
+        inline constexpr std::string_view title = "Title";
+        inline constexpr std::string_view ua_color = "UA-Color";
+        inline constexpr std::string_view ua_media = "UA-Media";
+        inline constexpr std::string_view ua_pixels = "UA-Pixels";
+        inline constexpr std::string_view ua_resolution = "UA-Resolution";
+        inline constexpr std::string_view ua_windowpixels = "UA-Windowpixels";
+        inline constexpr std::string_view version = "Version";
+        inline constexpr std::string_view x_device_accept = "X-Device-Accept";
+        inline constexpr std::string_view x_device_accept_charset = "X-Device-Accept-Charset";
+        inline constexpr std::string_view x_device_accept_encoding = "X-Device-Accept-Encoding";
+        inline constexpr std::string_view x_device_accept_language = "X-Device-Accept-Language";
+        inline constexpr std::string_view x_device_user_agent = "X-Device-User-Agent";
     } // namespace headder
 } // namespace sd
\ No newline at end of file
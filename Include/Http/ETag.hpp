@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "Common/XxHash64.hpp"
+#include "Http/BufferChain.hpp"
+
+namespace sd
+{
+    // Strong entity tags computed from response body
+    struct ETag
+    {
+        static std::string compute(std::string_view body) { return format(utils::XxHash64::hash(body)); }
+
+        static std::string fromBody(const BufferChain &body)
+        {
+            utils::XxHash64 hasher;
+            body.forEach([&](std::string_view segment) { hasher.update(segment); });
+            return format(hasher.digest());
+        }
+
+        // If-None-Match uses weak comparison, so W/ prefixes are ignored
+        static bool matches(std::string_view ifNoneMatch, std::string_view etag)
+        {
+            etag = stripWeak(etag);
+            while (!ifNoneMatch.empty())
+            {
+                auto end = ifNoneMatch.find(',');
+                auto candidate = trim(ifNoneMatch.substr(0, end));
+                if (candidate == "*" || stripWeak(candidate) == etag)
+                {
+                    return true;
+                }
+                ifNoneMatch.remove_prefix(end == std::string_view::npos ? ifNoneMatch.size() : end + 1);
+            }
+            return false;
+        }
+
+      private:
+        static std::string format(uint64_t hash)
+        {
+            constexpr std::string_view digits = "0123456789abcdef";
+            std::string result(18, '"');
+            for (int i = 16; i > 0; --i, hash >>= 4)
+            {
+                result[i] = digits[hash & 0xF];
+            }
+            return result;
+        }
+
+        static std::string_view stripWeak(std::string_view etag)
+        {
+            return etag.starts_with("W/") ? etag.substr(2) : etag;
+        }
+
+        static std::string_view trim(std::string_view value)
+        {
+            auto begin = value.find_first_not_of(" \t");
+            if (begin == std::string_view::npos)
+            {
+                return {};
+            }
+            return value.substr(begin, value.find_last_not_of(" \t") - begin + 1);
+        }
+    };
+} // namespace sd
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sd
+{
+    // Immutable set of response headers built once (at startup or as a static) and reused for every response
+    class HeaderBlock final
+    {
+      public:
+        struct Field
+        {
+            std::string name;
+            std::string value;
+        };
+
+        using Ptr = std::shared_ptr<const HeaderBlock>;
+
+      private:
+        std::vector<Field> _fields;
+
+      public:
+        HeaderBlock(std::initializer_list<Field> fields) : HeaderBlock(std::vector<Field>{fields}) {}
+
+        HeaderBlock(std::vector<Field> fields) : _fields(std::move(fields))
+        {
+            for (auto &field : _fields)
+            {
+                checkField(field);
+            }
+            _fields.shrink_to_fit();
+        }
+
+        auto begin() const { return _fields.begin(); }
+
+        auto end() const { return _fields.end(); }
+
+        size_t size() const { return _fields.size(); }
+
+        bool empty() const { return _fields.empty(); }
+
+      private:
+        static void checkField(const Field &field)
+        {
+            if (field.name.empty())
+            {
+                throw std::invalid_argument("Header name cannot be empty");
+            }
+            auto isInvalid = [](char c) { return c == '\r' || c == '\n'; };
+            if (std::ranges::any_of(field.name, isInvalid) || std::ranges::any_of(field.value, isInvalid))
+            {
+                throw std::invalid_argument("Header '" + field.name + "' contains forbidden characters");
+            }
+        }
+    };
+} // namespace sd
@@ -1,22 +1,33 @@
 #pragma once
 
-#include <functional>
 #include <memory>
-#include <optional>
-#include <string>
 #include <string_view>
 
 #include "Http/IHeaddersView.hpp"
-#include "Http/IParams.hpp"
 
 namespace sd
 {
-    struct IHeadders : public IHeaddersView, public IParams
+    // Response headers, operations write directly to the response being built
+    struct IHeadders : public virtual IHeaddersView
     {
         using Ptr = std::unique_ptr<IHeadders>;
 
+        // replaces all values of header
+        virtual void set(std::string_view name, std::string_view value) = 0;
+
+        // adds next value, existing values are kept
+        virtual void add(std::string_view name, std::string_view value) = 0;
+
+        // returns first value of header, header is added with given value if missing
+        virtual std::string_view getOrAdd(std::string_view name, std::string_view value = "") = 0;
+
+        // removes first value of header
+        virtual bool remove(std::string_view name) = 0;
+
         virtual size_t removeAll(std::string_view name) = 0;
 
+        virtual void clear() = 0;
+
         // virtual std::uint64_t getContentLength() const = 0;
 
         // virtual void setContentLength(std::uint64_t length) = 0;
@@ -37,9 +48,7 @@ namespace sd
 
         // virtual void setHttpMinor(std::uint16_t v) = 0;
 
-        std::string &operator[](std::string_view name) { return getOrAdd(name); }
-
         virtual ~IHeadders() = default;
     };
 
-} // namespace sd
\ No newline at end of file
+} // namespace sd
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -17,7 +19,11 @@ namespace sd
     {
         using Ptr = std::unique_ptr<IRequest>;
 
-        virtual std::string getBody() const = 0;
+        // view of the body owned by request, empty after takeBody
+        virtual std::string_view getBody() const = 0;
+
+        // moves body out of the request without copying
+        virtual std::string takeBody() = 0;
 
         //  io BodyReader
 
@@ -35,6 +41,17 @@ namespace sd
 
         virtual std::string_view getHost() const = 0;
 
+        // client address, taken from PROXY protocol header when listener has it enabled
+        virtual std::string_view getRemoteAddress() const = 0;
+
+        virtual uint16_t getRemotePort() const = 0;
+
+        // when server started reading request, time since then includes waiting for busy server threads
+        virtual std::chrono::steady_clock::time_point getArrivalTime() const = 0;
+
+        // true for sub-requests run by batch endpoint
+        virtual bool isBatched() const = 0;
+
         virtual bool isHttps() const = 0;
 
         virtual HttpMethod getMethod() const = 0;
@@ -2,6 +2,8 @@
 
 #include <memory>
 
+#include "Http/BufferChain.hpp"
+#include "Http/HeaderBlock.hpp"
 #include "Http/IHeadders.hpp"
 
 namespace sd
@@ -10,12 +12,23 @@ namespace sd
     {
         using Ptr = std::unique_ptr<IResponse>;
 
-        virtual void setBody(const std::string value) = 0;
+        virtual void setBody(std::string value) = 0;
+
+        virtual void setBody(BufferChain body) = 0;
+
+        virtual BufferChain &getBody() = 0;
 
         virtual void setStatusCode(int statusCode) = 0;
 
+        virtual int getStatusCode() const = 0;
+
         virtual IHeadders &getHeaders() = 0;
 
+        virtual void addHeaders(const HeaderBlock &headers) = 0;
+
+        // True once status code or body was set, headers alone do not count
+        virtual bool isWritten() const = 0;
+
         virtual ~IResponse() = default;
     };
 
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Common/Utils.hpp"
+#include "Http/BufferChain.hpp"
+#include "Http/HeaderBlock.hpp"
+#include "Http/IHeadders.hpp"
+#include "Http/IResponse.hpp"
+
+namespace sd
+{
+    // Finished response that can be replayed into other responses, body is serialized once and shared
+    struct ResponseSnapshot
+    {
+        using Ptr = std::shared_ptr<const ResponseSnapshot>;
+
+        int statusCode = 200;
+        std::vector<HeaderBlock::Field> headers;
+        std::shared_ptr<const std::string> body;
+
+        // Date header is skipped, replaying responses keep their own
+        static std::shared_ptr<ResponseSnapshot> capture(IResponse &response)
+        {
+            auto snapshot = std::make_shared<ResponseSnapshot>();
+            snapshot->statusCode = response.getStatusCode();
+            response.getHeaders().forEach([&](std::string_view name, std::string_view value) {
+                if (!utils::iequals(name, "Date"))
+                {
+                    snapshot->headers.push_back({std::string{name}, std::string{value}});
+                }
+                return IParamsView::Continue;
+            });
+            snapshot->body = std::make_shared<const std::string>(response.getBody().toString());
+            return snapshot;
+        }
+
+        void apply(IResponse &response) const
+        {
+            response.setStatusCode(statusCode);
+            auto &responseHeaders = response.getHeaders();
+            for (auto &header : headers)
+            {
+                responseHeaders.set(header.name, header.value);
+            }
+            BufferChain chain;
+            chain.append(body);
+            response.setBody(std::move(chain));
+        }
+    };
+} // namespace sd
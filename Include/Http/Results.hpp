@@ -1,8 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <string_view>
 
 #include "Common/Json.hpp"
+#include "Http/BufferChain.hpp"
+#include "Http/ETag.hpp"
+#include "Http/HeaderBlock.hpp"
 #include "Http/IResponse.hpp"
 #include "Http/IResult.hpp"
 
@@ -12,6 +17,8 @@ namespace sd
     class JsonResult : public IResult
     {
       private:
+        static inline const HeaderBlock Headers{{"Content-Type", "application/json; charset=utf-8"}};
+
         sd::Json _value;
         int _statusCode;
 
@@ -21,7 +28,7 @@ namespace sd
         void execute(IResponse &response)
         {
             response.setStatusCode(_statusCode);
-            response.getHeaders().add("Content-Type", "application/json; charset=utf-8");
+            response.addHeaders(Headers);
             response.setBody(tao::json::to_string(_value));
         }
     };
@@ -48,51 +55,185 @@ namespace sd
         {
             response.setStatusCode(200);
             response.getHeaders().add("Content-Type", _contentType);
-            response.setBody(_value);
+            response.setBody(std::move(_value));
         }
     };
 
     class BytesResult final : public IResult
     {
-        void execute(IResponse &response) {}
+      private:
+        std::string _value;
+        std::string _contentType;
+
+      public:
+        BytesResult(std::string value, std::string contentType = "application/octet-stream")
+            : _value(std::move(value)), _contentType(std::move(contentType))
+        {
+        }
+
+        void execute(IResponse &response)
+        {
+            response.setStatusCode(200);
+            response.getHeaders().set("Content-Type", _contentType);
+            response.setBody(std::move(_value));
+        }
     };
 
-    class StreamResult final : public IResult
+    // Content shared by all responses without copying, ETag is computed once when result is created
+    class StaticContentResult final : public IResult
     {
-        void execute(IResponse &response) {}
+      private:
+        std::shared_ptr<const std::string> _content;
+        std::string _contentType;
+        std::string _etag;
+
+      public:
+        StaticContentResult(std::string content, std::string contentType)
+            : StaticContentResult(std::make_shared<const std::string>(std::move(content)), std::move(contentType))
+        {
+        }
+
+        StaticContentResult(std::shared_ptr<const std::string> content, std::string contentType)
+            : _content(std::move(content)), _contentType(std::move(contentType)), _etag(ETag::compute(*_content))
+        {
+        }
+
+        const std::string &getETag() const { return _etag; }
+
+        void execute(IResponse &response)
+        {
+            response.setStatusCode(200);
+            auto &headers = response.getHeaders();
+            headers.set("Content-Type", _contentType);
+            headers.set("ETag", _etag);
+            BufferChain body;
+            body.append(_content);
+            response.setBody(std::move(body));
+        }
     };
 
-    class FileResult final : public IResult
+    class StreamResult final : public IResult
     {
         void execute(IResponse &response) {}
     };
-    class NotFoundResult final : public IResult
+
+    class FileResult final : public IResult
     {
         void execute(IResponse &response) {}
     };
+
     class NoContentResult final : public IResult
     {
-        void execute(IResponse &response) {}
-    };
-    class UnprocessableEntityResult final : public IResult
-    {
-        void execute(IResponse &response) {}
+      public:
+        void execute(IResponse &response)
+        {
+            response.setStatusCode(204);
+            response.setBody(BufferChain{});
+        }
     };
-    class BadRequestResult final : public IResult
+
+    // Problem details (RFC 7807) response, https://www.rfc-editor.org/rfc/rfc7807
+    class ProblemResult : public IResult
     {
-        void execute(IResponse &response) {}
+      private:
+        static inline const HeaderBlock Headers{{"Content-Type", "application/problem+json"}};
+
+        int _statusCode;
+        std::string _body;
+
+      public:
+        ProblemResult(int statusCode, std::string_view title, std::string_view detail = {},
+                      const sd::Json &errors = {})
+            : _statusCode(statusCode), _body(createBody(statusCode, title, detail, errors))
+        {
+        }
+
+        void execute(IResponse &response) { write(response, _statusCode, BufferChain{std::move(_body)}); }
+
+        static std::string createBody(int statusCode, std::string_view title, std::string_view detail = {},
+                                      const sd::Json &errors = {})
+        {
+            sd::Json body = {{"type", "about:blank"}, {"title", title}, {"status", statusCode}};
+            if (!detail.empty())
+            {
+                body["detail"] = detail;
+            }
+            if (!errors.is_uninitialized())
+            {
+                body["errors"] = errors;
+            }
+            return tao::json::to_string(body);
+        }
+
+        static void write(IResponse &response, int statusCode, BufferChain body)
+        {
+            response.setStatusCode(statusCode);
+            response.addHeaders(Headers);
+            response.setBody(std::move(body));
+        }
     };
-    class ConflictResult final : public IResult
+
+    constexpr std::string_view getProblemTitle(int statusCode)
     {
-        void execute(IResponse &response) {}
-    };
-    class ProblemResult final : public IResult
+        switch (statusCode)
+        {
+        case 400:
+            return "Bad Request";
+        case 401:
+            return "Unauthorized";
+        case 403:
+            return "Forbidden";
+        case 404:
+            return "Not Found";
+        case 409:
+            return "Conflict";
+        case 422:
+            return "Unprocessable Entity";
+        case 429:
+            return "Too Many Requests";
+        case 500:
+            return "Internal Server Error";
+        case 503:
+            return "Service Unavailable";
+        default:
+            return "Error";
+        }
+    }
+
+    // Problem without detail, body is serialized once and shared by all responses so error paths do not allocate it
+    template <int StatusCode> class StaticProblemResult final : public IResult
     {
-        void execute(IResponse &response) {}
+      public:
+        void execute(IResponse &response)
+        {
+            BufferChain body;
+            body.appendStatic(getBody());
+            ProblemResult::write(response, StatusCode, std::move(body));
+        }
+
+        static std::string_view getBody()
+        {
+            static const std::string body = ProblemResult::createBody(StatusCode, getProblemTitle(StatusCode));
+            return body;
+        }
     };
-    class ValidationProblemResult final : public IResult
+
+    using BadRequestResult = StaticProblemResult<400>;
+    using NotFoundResult = StaticProblemResult<404>;
+    using ConflictResult = StaticProblemResult<409>;
+    using UnprocessableEntityResult = StaticProblemResult<422>;
+    using TooManyRequestsResult = StaticProblemResult<429>;
+    using InternalServerErrorResult = StaticProblemResult<500>;
+    using ServiceUnavailableResult = StaticProblemResult<503>;
+
+    // errors object maps names of invalid fields to arrays of messages
+    class ValidationProblemResult final : public ProblemResult
     {
-        void execute(IResponse &response) {}
+      public:
+        ValidationProblemResult(const sd::Json &errors)
+            : ProblemResult(400, "One or more validation errors occurred.", {}, errors)
+        {
+        }
     };
 
     namespace Results
@@ -106,6 +247,23 @@ namespace sd
         {
             return std::make_unique<TextResult>(std::move(value), std::move(contentType));
         }
+        inline IResult::Ptr Bytes(std::string value, std::string contentType = "application/octet-stream")
+        {
+            return std::make_unique<BytesResult>(std::move(value), std::move(contentType));
+        }
+        inline IResult::Ptr NoContent() { return std::make_unique<NoContentResult>(); }
+        inline IResult::Ptr BadRequest() { return std::make_unique<BadRequestResult>(); }
+        inline IResult::Ptr NotFound() { return std::make_unique<NotFoundResult>(); }
+        inline IResult::Ptr Conflict() { return std::make_unique<ConflictResult>(); }
+        inline IResult::Ptr UnprocessableEntity() { return std::make_unique<UnprocessableEntityResult>(); }
+        inline IResult::Ptr Problem(int statusCode, std::string_view detail = {})
+        {
+            return std::make_unique<ProblemResult>(statusCode, getProblemTitle(statusCode), detail);
+        }
+        inline IResult::Ptr ValidationProblem(const sd::Json &errors)
+        {
+            return std::make_unique<ValidationProblemResult>(errors);
+        }
     } // namespace Results
 
-} // namespace sd
\ No newline at end of file
+} // namespace sd
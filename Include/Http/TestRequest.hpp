@@ -0,0 +1,29 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Http/HeaderBlock.hpp"
+#include "Http/HttpMethod.hpp"
+
+namespace sd
+{
+    // Request injected into application pipeline without network, see TestServer
+    struct TestRequest
+    {
+        HttpMethod method = HttpMethod::Get;
+
+        // path with optional query string, for example /users/1?fields=name
+        std::string target = "/";
+        std::vector<HeaderBlock::Field> headers;
+        std::string body;
+
+        std::string remoteAddress = "127.0.0.1";
+        uint16_t remotePort = 0;
+
+        // earlier time simulates request that waited in server queue
+        std::chrono::steady_clock::time_point arrivalTime = std::chrono::steady_clock::now();
+    };
+} // namespace sd
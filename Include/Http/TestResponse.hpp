@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Utils.hpp"
+#include "Http/HeaderBlock.hpp"
+
+namespace sd
+{
+    // Response produced by application pipeline for TestRequest
+    struct TestResponse
+    {
+        int statusCode = 0;
+        std::vector<HeaderBlock::Field> headers;
+        std::string body;
+
+        // First value of header (case insensitive) or empty string
+        std::string_view getHeader(std::string_view name) const
+        {
+            for (auto &header : headers)
+            {
+                if (utils::iequals(header.name, name))
+                {
+                    return header.value;
+                }
+            }
+            return {};
+        }
+
+        bool hasHeader(std::string_view name) const
+        {
+            for (auto &header : headers)
+            {
+                if (utils::iequals(header.name, name))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+} // namespace sd
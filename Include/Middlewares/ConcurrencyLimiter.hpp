@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+#include "Engine/RequestPriority.hpp"
+
+namespace sd
+{
+    struct ConcurrencyLimitOptions
+    {
+        uint32_t initialLimit = 64;
+        uint32_t minLimit = 8;
+        uint32_t maxLimit = 1024;
+
+        // requests completing later than target after their arrival shrink the limit, non critical requests that
+        // already waited longer than target are shed
+        std::chrono::milliseconds latencyTarget{250};
+
+        // limit is multiplied by it on slow request, at most once per latency target
+        double backoffRatio = 0.9;
+
+        // part of limit available for sheddable requests
+        double sheddableRatio = 0.8;
+    };
+
+    // AIMD limit of in flight requests: limit grows by one after limit fast requests completed, and shrinks
+    // multiplicatively when latency exceeds target. Latency is measured from request arrival, so time spent waiting
+    // for busy server threads counts even when endpoints are synchronous
+    class ConcurrencyLimiter
+    {
+      public:
+        using Clock = std::chrono::steady_clock;
+
+        // Admitted request, releases its slot and reports latency when destroyed
+        class Permit
+        {
+          private:
+            ConcurrencyLimiter *_limiter = nullptr;
+            Clock::time_point _arrival;
+
+          public:
+            Permit() = default;
+
+            Permit(ConcurrencyLimiter &limiter, Clock::time_point arrival) : _limiter(&limiter), _arrival(arrival) {}
+
+            Permit(Permit &&other) noexcept
+                : _limiter(std::exchange(other._limiter, nullptr)), _arrival(other._arrival)
+            {
+            }
+
+            Permit &operator=(Permit &&) = delete;
+
+            explicit operator bool() const { return _limiter; }
+
+            // releases slot reporting request completed at given time, destructor reports current time
+            void finish(Clock::time_point completion)
+            {
+                if (auto limiter = std::exchange(_limiter, nullptr))
+                {
+                    limiter->release(completion - _arrival, completion);
+                }
+            }
+
+            ~Permit() { finish(Clock::now()); }
+        };
+
+      private:
+        ConcurrencyLimitOptions _options;
+        std::atomic<uint32_t> _limit;
+        std::atomic<uint32_t> _inFlight{0};
+        std::atomic<uint32_t> _fastCompletions{0};
+        std::atomic<int64_t> _lastBackoff{0};
+
+      public:
+        explicit ConcurrencyLimiter(ConcurrencyLimitOptions options = {})
+            : _options(options), _limit(std::clamp(options.initialLimit, options.minLimit, options.maxLimit))
+        {
+        }
+
+        // empty permit when request should be shed, arrival is when server started reading request
+        Permit tryAcquire(RequestPriority priority, Clock::time_point arrival = Clock::now())
+        {
+            auto now = Clock::now();
+            if (priority != RequestPriority::Critical && now - arrival > _options.latencyTarget)
+            {
+                // request already queued longer than target, running it would only add to the queue
+                backoff(now);
+                return {};
+            }
+            auto inFlight = _inFlight.fetch_add(1, std::memory_order_relaxed);
+            if (priority != RequestPriority::Critical && inFlight >= getCapacity(priority))
+            {
+                _inFlight.fetch_sub(1, std::memory_order_relaxed);
+                return {};
+            }
+            return Permit{*this, arrival};
+        }
+
+        uint32_t getLimit() const { return _limit.load(std::memory_order_relaxed); }
+
+        uint32_t getInFlight() const { return _inFlight.load(std::memory_order_relaxed); }
+
+      private:
+        uint32_t getCapacity(RequestPriority priority) const
+        {
+            auto limit = getLimit();
+            if (priority == RequestPriority::Sheddable)
+            {
+                return static_cast<uint32_t>(limit * _options.sheddableRatio);
+            }
+            return limit;
+        }
+
+        void release(Clock::duration latency, Clock::time_point now)
+        {
+            _inFlight.fetch_sub(1, std::memory_order_relaxed);
+            if (latency > _options.latencyTarget)
+            {
+                return backoff(now);
+            }
+            // additive increase, about one per limit worth of completed requests
+            auto limit = getLimit();
+            if (_fastCompletions.fetch_add(1, std::memory_order_relaxed) + 1 < limit)
+            {
+                return;
+            }
+            _fastCompletions.store(0, std::memory_order_relaxed);
+            if (limit < _options.maxLimit)
+            {
+                _limit.compare_exchange_strong(limit, limit + 1, std::memory_order_relaxed);
+            }
+        }
+
+        // requests that queued behind the same burst complete together, they shrink limit once
+        void backoff(Clock::time_point time)
+        {
+            auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+            auto last = _lastBackoff.load(std::memory_order_relaxed);
+            auto period = std::chrono::nanoseconds{_options.latencyTarget}.count();
+            if (now - last < period || !_lastBackoff.compare_exchange_strong(last, now, std::memory_order_relaxed))
+            {
+                return;
+            }
+            auto limit = getLimit();
+            auto reduced = std::max(_options.minLimit, static_cast<uint32_t>(limit * _options.backoffRatio));
+            _limit.store(reduced, std::memory_order_relaxed);
+            _fastCompletions.store(0, std::memory_order_relaxed);
+        }
+    };
+} // namespace sd
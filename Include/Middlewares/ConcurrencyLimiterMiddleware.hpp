@@ -0,0 +1,73 @@
+#pragma once
+
+#include <memory>
+#include <typeinfo>
+#include <utility>
+
+#include "Common/Task.hpp"
+#include "Engine/IContext.hpp"
+#include "Engine/IEndpoint.hpp"
+#include "Engine/RequestPriority.hpp"
+#include "Http/IRequest.hpp"
+#include "Http/Results.hpp"
+#include "Middlewares/ConcurrencyLimiter.hpp"
+#include "Middlewares/IMiddleware.hpp"
+#include "Middlewares/IMiddlewareCreator.hpp"
+
+namespace sd
+{
+    // Sheds requests over adaptive concurrency limit, or queued longer than latency target, with 503 Service
+    // Unavailable. Priority comes from matched endpoint, so it should be used after router middleware, unmatched
+    // requests are Normal
+    class ConcurrencyLimiterMiddleware final : public IMiddleware
+    {
+      private:
+        ConcurrencyLimiter _limiter;
+
+      public:
+        ConcurrencyLimiterMiddleware() = default;
+
+        explicit ConcurrencyLimiterMiddleware(ConcurrencyLimitOptions options) : _limiter(options) {}
+
+        void next(IContext &ctx, INextCallback &callback) final { handle(ctx, callback); }
+
+        template <class NextCallback> void handle(IContext &ctx, NextCallback &callback)
+        {
+            auto endpoint = ctx.getRoutingData().getEndpoint();
+            auto permit = _limiter.tryAcquire(endpoint ? endpoint->getPriority() : RequestPriority::Normal,
+                                              ctx.getRequest().getArrivalTime());
+            if (!permit)
+            {
+                return ServiceUnavailableResult{}.execute(ctx.getResponse());
+            }
+            callback.next();
+            if (auto continuation = ctx.takeContinuation())
+            {
+                // slot is held until async part completes
+                ctx.setContinuation(holdDuring(std::move(continuation), std::move(permit)));
+            }
+        }
+
+        ConcurrencyLimiter &getLimiter() { return _limiter; }
+    };
+
+    class ConcurrencyLimiterMiddlewareCreator final : public IMiddlewareCreator
+    {
+      private:
+        ConcurrencyLimitOptions _options;
+
+      public:
+        explicit ConcurrencyLimiterMiddlewareCreator(ConcurrencyLimitOptions options) : _options(options) {}
+
+        MiddlewareLifetime getLifetime() const final { return MiddlewareLifetime::Singleton; }
+
+        IMiddleware::Ptr createSingleton() final { return std::make_unique<ConcurrencyLimiterMiddleware>(_options); }
+
+        IMiddleware::Ptr create(IContext &ctx) final { return createSingleton(); }
+
+        bool provides(const std::type_info &middleware) const final
+        {
+            return middleware == typeid(ConcurrencyLimiterMiddleware);
+        }
+    };
+} // namespace sd
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <string>
+
+#include "Common/Task.hpp"
+#include "Engine/IContext.hpp"
+#include "Http/BufferChain.hpp"
+#include "Http/ETag.hpp"
+#include "Http/HttpMethod.hpp"
+#include "Http/IResponse.hpp"
+#include "Middlewares/IMiddleware.hpp"
+#include "Middlewares/MiddlewareCreator.hpp"
+
+namespace sd
+{
+    // Adds ETag to successful GET responses and answers matching If-None-Match with 304 Not Modified.
+    // ETag already set by the response (static results, output cache hits) is reused instead of hashing the body,
+    // so it should be used before output cache middleware. HEAD responses have no body to hash, their tag would
+    // differ from GET one, so only ETag set by HEAD endpoint is compared
+    class ETagMiddleware final : public IMiddleware
+    {
+      public:
+        void next(IContext &ctx, INextCallback &callback) final { handle(ctx, callback); }
+
+        template <class NextCallback> void handle(IContext &ctx, NextCallback &callback)
+        {
+            auto method = ctx.getRequest().getMethod();
+            callback.next();
+            if (method != HttpMethod::Get && method != HttpMethod::Head)
+            {
+                return;
+            }
+            if (auto continuation = ctx.takeContinuation())
+            {
+                return ctx.setContinuation(applyAfter(ctx, std::move(continuation)));
+            }
+            apply(ctx);
+        }
+
+      private:
+        static void apply(IContext &ctx)
+        {
+            auto &response = ctx.getResponse();
+            if (response.getStatusCode() != 200)
+            {
+                return;
+            }
+            auto &headers = response.getHeaders();
+            std::string etag;
+            if (auto existing = headers.get("ETag"))
+            {
+                etag = *existing;
+            }
+            else if (ctx.getRequest().getMethod() == HttpMethod::Head)
+            {
+                return;
+            }
+            else
+            {
+                etag = ETag::fromBody(response.getBody());
+                headers.set("ETag", etag);
+            }
+            auto ifNoneMatch = ctx.getRequest().getHeaders().get("If-None-Match");
+            if (ifNoneMatch && ETag::matches(*ifNoneMatch, etag))
+            {
+                notModified(response);
+            }
+        }
+
+        // 304 has no content, headers describing it would overwrite ones stored by caches (RFC 9110 15.4.5)
+        static void notModified(IResponse &response)
+        {
+            response.setStatusCode(304);
+            response.setBody(BufferChain{});
+            auto &headers = response.getHeaders();
+            for (auto name : {"Content-Length", "Content-Type", "Content-Encoding", "Content-Language",
+                              "Content-Range", "Transfer-Encoding"})
+            {
+                headers.removeAll(name);
+            }
+        }
+
+        static Task<> applyAfter(IContext &ctx, Task<> action)
+        {
+            co_await action;
+            apply(ctx);
+        }
+    };
+
+    using ETagMiddlewareCreator = MiddlewareCreator<ETagMiddleware, MiddlewareLifetime::Singleton>;
+} // namespace sd
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <typeinfo>
+
+#include "Engine/IEndpoint.hpp"
+#include "Middlewares/IMiddleware.hpp"
+#include "Middlewares/MiddlewareCreator.hpp"
+
+namespace sd
+{
+    class EndpointsMiddleware final : public IMiddleware
+    {
+      public:
+        void next(IContext &ctx, INextCallback &callback) final { handle(ctx, callback); }
+
+        template <class NextCallback> void handle(IContext &ctx, NextCallback &callback)
+        {
+            if (auto endpoint = ctx.getRoutingData().getEndpoint())
+            {
+                return endpoint->executeAction(ctx);
+            }
+            callback.next();
+        }
+    };
+
+    class EndpointsMiddlewareCreator final : public IMiddlewareCreator
+    {
+      public:
+        MiddlewareLifetime getLifetime() const final { return MiddlewareLifetime::Singleton; }
+
+        IMiddleware::Ptr createSingleton() final { return std::make_unique<EndpointsMiddleware>(); }
+
+        IMiddleware::Ptr create(IContext &ctx) final { return createSingleton(); }
+
+        bool provides(const std::type_info &middleware) const final
+        {
+            return middleware == typeid(EndpointsMiddleware);
+        }
+    };
+} // namespace sd
\ No newline at end of file
@@ -11,6 +11,9 @@ namespace sd
     {
         bool isAuthorized = false;
         std::string reason = "";
+
+        // WWW-Authenticate value sent with 401 to unauthenticated caller, Bearer when empty
+        std::string challenge = "";
     };
 
     struct IAuthorizer
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <typeinfo>
 
 #include "Common/Utils.hpp"
 #include "Engine/IContext.hpp"
@@ -8,12 +9,25 @@
 
 namespace sd
 {
+    enum class MiddlewareLifetime
+    {
+        Singleton, // created once on application init and shared by all requests, must be thread safe
+        Scoped     // created for each request
+    };
+
     struct IMiddlewareCreator
     {
         using Ptr = std::unique_ptr<IMiddlewareCreator>;
 
+        virtual MiddlewareLifetime getLifetime() const { return MiddlewareLifetime::Scoped; }
+
+        virtual IMiddleware::Ptr createSingleton() { return nullptr; }
+
         virtual IMiddleware::Ptr create(IContext &ctx) = 0;
 
+        // true if created middleware is or contains middleware of given type
+        virtual bool provides(const std::type_info &middleware) const { return false; }
+
         virtual ~IMiddlewareCreator() = default;
     };
-} // namespace sd
\ No newline at end of file
+} // namespace sd
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <typeinfo>
 #include <type_traits>
 
 #include "Common/Utils.hpp"
@@ -10,7 +11,8 @@
 
 namespace sd
 {
-    template <class MiddlewareT> class MiddlewareCreator final : public IMiddlewareCreator
+    template <class MiddlewareT, MiddlewareLifetime Lifetime = MiddlewareLifetime::Scoped>
+    class MiddlewareCreator final : public IMiddlewareCreator
     {
       public:
         using Ptr = std::unique_ptr<MiddlewareCreator>;
@@ -18,6 +20,21 @@ namespace sd
         MiddlewareCreator()
         {
             static_assert(std::is_base_of_v<IMiddleware, MiddlewareT>, "Type T must inherit from IMiddleware");
+            static_assert(Lifetime == MiddlewareLifetime::Scoped || std::is_default_constructible_v<MiddlewareT>,
+                          "Singleton middleware should be default constructible");
+        }
+
+        MiddlewareLifetime getLifetime() const { return Lifetime; }
+
+        bool provides(const std::type_info &middleware) const { return middleware == typeid(MiddlewareT); }
+
+        IMiddleware::Ptr createSingleton()
+        {
+            if constexpr (Lifetime == MiddlewareLifetime::Singleton)
+            {
+                return std::make_unique<MiddlewareT>();
+            }
+            return nullptr;
         }
 
         IMiddleware::Ptr create(IContext &ctx)
@@ -36,4 +53,4 @@ namespace sd
             }
         }
     };
-} // namespace sd
\ No newline at end of file
+} // namespace sd
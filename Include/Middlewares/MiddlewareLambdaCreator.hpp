@@ -6,7 +6,9 @@
 
 namespace sd
 {
-    template <class Lambda> class MiddlewareLambdaCreator final : public IMiddlewareCreator
+    // Scoped lambda is copied for each request, singleton one is shared by all requests
+    template <class Lambda, MiddlewareLifetime Lifetime = MiddlewareLifetime::Scoped>
+    class MiddlewareLambdaCreator final : public IMiddlewareCreator
     {
       private:
         Lambda _lambda;
@@ -14,6 +16,17 @@ namespace sd
       public:
         MiddlewareLambdaCreator(Lambda lambda) : _lambda(lambda) {}
 
+        MiddlewareLifetime getLifetime() const { return Lifetime; }
+
+        IMiddleware::Ptr createSingleton()
+        {
+            if constexpr (Lifetime == MiddlewareLifetime::Singleton)
+            {
+                return std::make_unique<MiddlewareLambda<Lambda>>(_lambda);
+            }
+            return nullptr;
+        }
+
         IMiddleware::Ptr create(IContext &ctx) { return std::make_unique<MiddlewareLambda<Lambda>>(_lambda); }
     };
 } // namespace sd
\ No newline at end of file
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Common/ShardedMap.hpp"
+#include "Engine/OutputCachePolicy.hpp"
+#include "Http/ResponseSnapshot.hpp"
+
+namespace sd
+{
+    struct OutputCacheOptions
+    {
+        // total size of cached entries in bytes, split evenly between shards
+        size_t maxSize = 64 * 1024 * 1024;
+    };
+
+    // Size bounded LRU store of serialized responses, split into independently locked shards
+    class OutputCache
+    {
+      public:
+        using Ptr = std::shared_ptr<OutputCache>;
+        using Clock = std::chrono::steady_clock;
+
+        struct Entry
+        {
+            ResponseSnapshot::Ptr response; // null for entries remembering only policy of a route
+            OutputCachePolicy::Ptr policy;
+            Clock::time_point expires;
+        };
+
+      private:
+        static constexpr size_t Shards = 16;
+
+        struct Node
+        {
+            std::string key;
+            Entry entry;
+            size_t size = 0;
+        };
+
+        using Nodes = std::list<Node>;
+
+        struct alignas(64) Shard
+        {
+            std::mutex mutex;
+            Nodes lru; // most recently used first
+            std::unordered_map<std::string_view, Nodes::iterator> index;
+            size_t size = 0;
+        };
+
+        std::array<Shard, Shards> _shards;
+        size_t _shardCapacity;
+
+      public:
+        explicit OutputCache(OutputCacheOptions options = {}) : _shardCapacity(options.maxSize / Shards) {}
+
+        std::optional<Entry> get(std::string_view key)
+        {
+            auto &shard = getShard(key);
+            std::lock_guard lock{shard.mutex};
+            auto it = shard.index.find(key);
+            if (it == shard.index.end())
+            {
+                return std::nullopt;
+            }
+            auto node = it->second;
+            if (node->entry.expires <= Clock::now())
+            {
+                remove(shard, node);
+                return std::nullopt;
+            }
+            shard.lru.splice(shard.lru.begin(), shard.lru, node);
+            return node->entry;
+        }
+
+        // least recently used entries are evicted when shard is full, entries bigger than shard are not stored
+        void set(std::string key, Entry entry)
+        {
+            auto size = getSize(key, entry);
+            if (size > _shardCapacity)
+            {
+                return;
+            }
+            auto &shard = getShard(key);
+            std::lock_guard lock{shard.mutex};
+            if (auto it = shard.index.find(key); it != shard.index.end())
+            {
+                remove(shard, it->second);
+            }
+            while (!shard.lru.empty() && shard.size + size > _shardCapacity)
+            {
+                remove(shard, std::prev(shard.lru.end()));
+            }
+            auto &node = shard.lru.emplace_front(Node{std::move(key), std::move(entry), size});
+            shard.index.emplace(node.key, shard.lru.begin());
+            shard.size += size;
+        }
+
+        // removes entries stored for endpoints with policy tagged with tag, returns number of removed entries
+        size_t evictByTag(std::string_view tag)
+        {
+            size_t removed = 0;
+            for (auto &shard : _shards)
+            {
+                std::lock_guard lock{shard.mutex};
+                for (auto it = shard.lru.begin(); it != shard.lru.end();)
+                {
+                    auto &tags = it->entry.policy->tags;
+                    auto current = it++;
+                    if (std::find(tags.begin(), tags.end(), tag) != tags.end())
+                    {
+                        removed += current->entry.response ? 1 : 0;
+                        remove(shard, current);
+                    }
+                }
+            }
+            return removed;
+        }
+
+        void clear()
+        {
+            for (auto &shard : _shards)
+            {
+                std::lock_guard lock{shard.mutex};
+                shard.index.clear();
+                shard.lru.clear();
+                shard.size = 0;
+            }
+        }
+
+        // bytes used by entries
+        size_t size()
+        {
+            size_t result = 0;
+            for (auto &shard : _shards)
+            {
+                std::lock_guard lock{shard.mutex};
+                result += shard.size;
+            }
+            return result;
+        }
+
+      private:
+        Shard &getShard(std::string_view key)
+        {
+            return _shards[utils::getShardIndex<Shards>(std::hash<std::string_view>{}(key))];
+        }
+
+        static void remove(Shard &shard, Nodes::iterator node)
+        {
+            shard.size -= node->size;
+            shard.index.erase(node->key);
+            shard.lru.erase(node);
+        }
+
+        static size_t getSize(const std::string &key, const Entry &entry)
+        {
+            auto size = sizeof(Node) + key.size();
+            if (auto &response = entry.response)
+            {
+                size += response->body ? response->body->size() : 0;
+                for (auto &header : response->headers)
+                {
+                    size += header.name.size() + header.value.size();
+                }
+            }
+            return size;
+        }
+    };
+} // namespace sd
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <utility>
+
+#include "Common/Task.hpp"
+#include "Common/Utils.hpp"
+#include "Engine/IContext.hpp"
+#include "Engine/IEndpoint.hpp"
+#include "Engine/OutputCachePolicy.hpp"
+#include "Http/ETag.hpp"
+#include "Http/HttpMethod.hpp"
+#include "Http/IRequest.hpp"
+#include "Http/ResponseSnapshot.hpp"
+#include "Middlewares/IMiddleware.hpp"
+#include "Middlewares/IMiddlewareCreator.hpp"
+#include "Middlewares/OutputCache.hpp"
+
+namespace sd
+{
+    // Serves stored responses of endpoints marked with IEndpoint::cacheOutput. Used before router middleware it
+    // serves hits without routing, policy of each cached route is remembered next to its responses. Requests with
+    // credentials (Authorization or Cookie header) bypass cache and responses for authenticated users are not stored,
+    // unless policy keys entries by that header
+    class OutputCacheMiddleware final : public IMiddleware
+    {
+      private:
+        OutputCache::Ptr _cache;
+
+      public:
+        OutputCacheMiddleware() : OutputCacheMiddleware(std::make_shared<OutputCache>()) {}
+
+        explicit OutputCacheMiddleware(OutputCache::Ptr cache) : _cache(std::move(cache)) {}
+
+        void next(IContext &ctx, INextCallback &callback) final { handle(ctx, callback); }
+
+        template <class NextCallback> void handle(IContext &ctx, NextCallback &callback)
+        {
+            auto &request = ctx.getRequest();
+            auto method = request.getMethod();
+            if (method != HttpMethod::Get && method != HttpMethod::Head)
+            {
+                return callback.next();
+            }
+            auto routeKey = std::to_string(method) + ' ' + request.getPath();
+            if (auto policy = findPolicy(ctx, routeKey); policy && isCacheable(request, *policy))
+            {
+                if (auto entry = _cache->get(makeKey(routeKey, request, *policy)))
+                {
+                    return entry->response->apply(ctx.getResponse());
+                }
+            }
+            callback.next();
+
+            auto endpoint = ctx.getRoutingData().getEndpoint();
+            if (!endpoint)
+            {
+                return;
+            }
+            auto &policy = endpoint->getOutputCachePolicy();
+            if (!policy || !isCacheable(request, *policy))
+            {
+                return;
+            }
+            if (auto continuation = ctx.takeContinuation())
+            {
+                return ctx.setContinuation(storeAfter(ctx, std::move(continuation), std::move(routeKey), policy));
+            }
+            store(ctx, std::move(routeKey), policy);
+        }
+
+        OutputCache &getCache() { return *_cache; }
+
+      private:
+        OutputCachePolicy::Ptr findPolicy(IContext &ctx, const std::string &routeKey)
+        {
+            if (auto endpoint = ctx.getRoutingData().getEndpoint())
+            {
+                return endpoint->getOutputCachePolicy();
+            }
+            auto entry = _cache->get(routeKey);
+            return entry ? entry->policy : nullptr;
+        }
+
+        // Credentials make response specific to caller, request with them is cached only when policy keys entries by
+        // them
+        static bool isCacheable(const IRequest &request, const OutputCachePolicy &policy)
+        {
+            auto &headers = request.getHeaders();
+            return (!headers.has("Authorization") || variesBy(policy, "Authorization")) &&
+                   (!headers.has("Cookie") || variesBy(policy, "Cookie"));
+        }
+
+        static bool isKeyedByCaller(const IRequest &request, const OutputCachePolicy &policy)
+        {
+            auto &headers = request.getHeaders();
+            return (headers.has("Authorization") && variesBy(policy, "Authorization")) ||
+                   (headers.has("Cookie") && variesBy(policy, "Cookie"));
+        }
+
+        static bool variesBy(const OutputCachePolicy &policy, std::string_view header)
+        {
+            return std::any_of(policy.varyByHeaders.begin(), policy.varyByHeaders.end(),
+                               [&](const std::string &name) { return utils::iequals(name, header); });
+        }
+
+        // only complete, successful responses not setting cookies are stored, ETag is computed once here so
+        // ETag middleware does not hash cache hits. User is known only after pipeline ran (authentication
+        // middleware may follow this one), so responses for authenticated users are dropped here
+        void store(IContext &ctx, std::string routeKey, const OutputCachePolicy::Ptr &policyPtr)
+        {
+            auto &policy = *policyPtr;
+            auto &response = ctx.getResponse();
+            auto &headers = response.getHeaders();
+            if (response.getStatusCode() != 200 || response.getBody().size() > policy.maxEntrySize ||
+                headers.has("Set-Cookie") || (ctx.isAuthenticated() && !isKeyedByCaller(ctx.getRequest(), policy)))
+            {
+                return;
+            }
+            auto snapshot = ResponseSnapshot::capture(response);
+            if (!headers.has("ETag"))
+            {
+                auto etag = ETag::compute(*snapshot->body);
+                headers.set("ETag", etag);
+                snapshot->headers.push_back({"ETag", std::move(etag)});
+            }
+            auto expires = OutputCache::Clock::now() + policy.duration;
+            _cache->set(makeKey(routeKey, ctx.getRequest(), policy), {std::move(snapshot), policyPtr, expires});
+            _cache->set(std::move(routeKey), {nullptr, policyPtr, expires});
+        }
+
+        Task<> storeAfter(IContext &ctx, Task<> action, std::string routeKey, OutputCachePolicy::Ptr policy)
+        {
+            co_await action;
+            store(ctx, std::move(routeKey), policy);
+        }
+
+        // values are length prefixed so different requests can not produce same key
+        static std::string makeKey(std::string_view routeKey, const IRequest &request, const OutputCachePolicy &policy)
+        {
+            std::string key{routeKey};
+            key += '?';
+            if (policy.varyByQuery.empty())
+            {
+                key += request.getQueryString();
+            }
+            else
+            {
+                auto &query = request.getQuery();
+                for (auto &name : policy.varyByQuery)
+                {
+                    appendValue(key, query.get(name));
+                }
+            }
+            key += '\n';
+            auto &headers = request.getHeaders();
+            for (auto &name : policy.varyByHeaders)
+            {
+                appendValue(key, headers.get(name));
+            }
+            return key;
+        }
+
+        static void appendValue(std::string &key, std::optional<std::string_view> value)
+        {
+            if (!value)
+            {
+                key += '-';
+                return;
+            }
+            key += std::to_string(value->size());
+            key += ':';
+            key += *value;
+        }
+    };
+
+    class OutputCacheMiddlewareCreator final : public IMiddlewareCreator
+    {
+      private:
+        OutputCache::Ptr _cache;
+
+      public:
+        explicit OutputCacheMiddlewareCreator(OutputCache::Ptr cache) : _cache(std::move(cache)) {}
+
+        MiddlewareLifetime getLifetime() const final { return MiddlewareLifetime::Singleton; }
+
+        IMiddleware::Ptr createSingleton() final { return std::make_unique<OutputCacheMiddleware>(_cache); }
+
+        IMiddleware::Ptr create(IContext &ctx) final { return createSingleton(); }
+
+        bool provides(const std::type_info &middleware) const final
+        {
+            return middleware == typeid(OutputCacheMiddleware);
+        }
+    };
+} // namespace sd
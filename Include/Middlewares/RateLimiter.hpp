@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Common/ShardedMap.hpp"
+#include "Common/SharedTimer.hpp"
+
+namespace sd
+{
+    struct RateLimitPolicy
+    {
+        enum class Partition
+        {
+            ClientIp,
+            Header, // requests without header are partitioned by client ip
+            Route   // route template of matched endpoint, request path before routing
+        };
+
+        Partition partitionBy = Partition::ClientIp;
+        std::string header = "X-Api-Key";
+
+        // bucket capacity, allowed burst of requests
+        uint32_t permits = 100;
+
+        // time in which empty bucket is refilled
+        std::chrono::milliseconds window = std::chrono::seconds{1};
+
+        // how often buckets that refilled completely are removed
+        std::chrono::milliseconds cleanupInterval = std::chrono::seconds{30};
+
+        // upper bound of stored buckets split evenly between shards, bounds memory used by distinct keys,
+        // new keys that do not fit until cleanup share one overflow bucket
+        size_t maxBuckets = 100'000;
+    };
+
+    // Token buckets stored as single atomic theoretical arrival time (GCRA), refilled lazily from monotonic clock.
+    // Buckets are found under shared shard lock, taking tokens is lock free
+    class RateLimiter
+    {
+      public:
+        using Clock = std::chrono::steady_clock;
+
+      private:
+        static constexpr size_t Shards = 16;
+
+        struct Bucket
+        {
+            // time when bucket will be full again, tokens are taken by moving it forward
+            std::atomic<int64_t> fullAt{0};
+        };
+
+        struct Hash
+        {
+            using is_transparent = void;
+
+            size_t operator()(std::string_view key) const { return std::hash<std::string_view>{}(key); }
+        };
+
+        struct alignas(64) Shard
+        {
+            std::shared_mutex mutex;
+            std::unordered_map<std::string, Bucket, Hash, std::equal_to<>> buckets;
+        };
+
+        std::array<Shard, Shards> _shards;
+        int64_t _interval; // time to refill one token
+        int64_t _capacity; // time to refill whole bucket
+        size_t _maxShardBuckets;
+        Bucket _overflow;
+        std::chrono::milliseconds _cleanupInterval;
+        SharedTimer::Id _cleanupTimer; // last, started once buckets exist
+
+      public:
+        explicit RateLimiter(const RateLimitPolicy &policy)
+            : _interval(getInterval(policy)), _capacity(_interval * std::max(policy.permits, 1u)),
+              _maxShardBuckets(getMaxShardBuckets(policy)), _cleanupInterval(getCleanupInterval(policy)),
+              _cleanupTimer(SharedTimer::getInstance().start(Clock::now() + _cleanupInterval, [this] {
+                  cleanup();
+                  return std::optional{Clock::now() + _cleanupInterval};
+              }))
+        {
+        }
+
+        RateLimiter(const RateLimiter &) = delete;
+        RateLimiter &operator=(const RateLimiter &) = delete;
+
+        ~RateLimiter() { SharedTimer::getInstance().cancel(_cleanupTimer); }
+
+        // zero when token was taken, otherwise time after which next token will be available
+        std::chrono::nanoseconds acquire(std::string_view key, Clock::time_point time = Clock::now())
+        {
+            auto now = toNanoseconds(time);
+            if (auto wait = tryAcquire(key, now))
+            {
+                return *wait;
+            }
+            return take(_overflow, now);
+        }
+
+        // same as acquire, but nullopt when key has no bucket and its shard is full
+        std::optional<std::chrono::nanoseconds> tryAcquire(std::string_view key, Clock::time_point time = Clock::now())
+        {
+            return tryAcquire(key, toNanoseconds(time));
+        }
+
+        // removes buckets that refilled completely, they are equal to new ones
+        void cleanup(Clock::time_point time = Clock::now())
+        {
+            auto now = toNanoseconds(time);
+            for (auto &shard : _shards)
+            {
+                std::unique_lock lock{shard.mutex};
+                std::erase_if(shard.buckets,
+                              [&](auto &bucket) { return bucket.second.fullAt.load(std::memory_order_relaxed) <= now; });
+            }
+        }
+
+        size_t size()
+        {
+            size_t result = 0;
+            for (auto &shard : _shards)
+            {
+                std::shared_lock lock{shard.mutex};
+                result += shard.buckets.size();
+            }
+            return result;
+        }
+
+      private:
+        std::optional<std::chrono::nanoseconds> tryAcquire(std::string_view key, int64_t now)
+        {
+            auto &shard = getShard(key);
+            {
+                std::shared_lock lock{shard.mutex};
+                if (auto it = shard.buckets.find(key); it != shard.buckets.end())
+                {
+                    return take(it->second, now);
+                }
+            }
+            std::unique_lock lock{shard.mutex};
+            if (auto it = shard.buckets.find(key); it != shard.buckets.end())
+            {
+                return take(it->second, now);
+            }
+            if (shard.buckets.size() >= _maxShardBuckets)
+            {
+                return std::nullopt;
+            }
+            return take(shard.buckets.try_emplace(std::string{key}).first->second, now);
+        }
+
+        static int64_t getInterval(const RateLimitPolicy &policy)
+        {
+            auto interval = std::chrono::nanoseconds{policy.window}.count() / std::max(policy.permits, 1u);
+            if (interval <= 0)
+            {
+                throw std::runtime_error("Rate limit window is too short for " + std::to_string(policy.permits) +
+                                         " permits");
+            }
+            return interval;
+        }
+
+        static size_t getMaxShardBuckets(const RateLimitPolicy &policy)
+        {
+            if (!policy.maxBuckets)
+            {
+                throw std::runtime_error("Rate limit max buckets must be positive");
+            }
+            return (policy.maxBuckets + Shards - 1) / Shards;
+        }
+
+        static std::chrono::milliseconds getCleanupInterval(const RateLimitPolicy &policy)
+        {
+            if (policy.cleanupInterval.count() <= 0)
+            {
+                throw std::runtime_error("Rate limit cleanup interval must be positive");
+            }
+            return policy.cleanupInterval;
+        }
+
+        static int64_t toNanoseconds(Clock::time_point time)
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+        }
+
+        std::chrono::nanoseconds take(Bucket &bucket, int64_t now)
+        {
+            auto fullAt = bucket.fullAt.load(std::memory_order_relaxed);
+            while (true)
+            {
+                auto next = std::max(fullAt, now) + _interval;
+                if (next - now > _capacity)
+                {
+                    return std::chrono::nanoseconds{next - now - _capacity};
+                }
+                if (bucket.fullAt.compare_exchange_weak(fullAt, next, std::memory_order_relaxed))
+                {
+                    return std::chrono::nanoseconds{0};
+                }
+            }
+        }
+
+        Shard &getShard(std::string_view key) { return _shards[utils::getShardIndex<Shards>(Hash{}(key))]; }
+    };
+} // namespace sd
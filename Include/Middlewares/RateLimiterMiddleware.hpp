@@ -0,0 +1,101 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <utility>
+
+#include "Engine/IContext.hpp"
+#include "Engine/IEndpoint.hpp"
+#include "Http/IRequest.hpp"
+#include "Http/IResponse.hpp"
+#include "Http/Results.hpp"
+#include "Middlewares/IMiddleware.hpp"
+#include "Middlewares/IMiddlewareCreator.hpp"
+#include "Middlewares/RateLimiter.hpp"
+
+namespace sd
+{
+    // Rejects requests over policy limit with 429 Too Many Requests before they reach handlers
+    class RateLimiterMiddleware final : public IMiddleware
+    {
+      private:
+        RateLimitPolicy _policy;
+        RateLimiter _limiter;
+
+      public:
+        RateLimiterMiddleware() : RateLimiterMiddleware(RateLimitPolicy{}) {}
+
+        explicit RateLimiterMiddleware(RateLimitPolicy policy) : _policy(std::move(policy)), _limiter(_policy) {}
+
+        void next(IContext &ctx, INextCallback &callback) final { handle(ctx, callback); }
+
+        template <class NextCallback> void handle(IContext &ctx, NextCallback &callback)
+        {
+            if (auto wait = acquire(ctx); wait.count() > 0)
+            {
+                return reject(ctx.getResponse(), wait);
+            }
+            callback.next();
+        }
+
+        RateLimiter &getLimiter() { return _limiter; }
+
+      private:
+        std::chrono::nanoseconds acquire(IContext &ctx)
+        {
+            auto &request = ctx.getRequest();
+            switch (_policy.partitionBy)
+            {
+            case RateLimitPolicy::Partition::Header:
+                if (auto value = request.getHeaders().get(_policy.header))
+                {
+                    // header values are chosen by caller, once buckets are full new ones are limited by address
+                    if (auto wait = _limiter.tryAcquire(*value))
+                    {
+                        return *wait;
+                    }
+                }
+                // header values can not contain new line, so addresses do not collide with them
+                return _limiter.acquire("\n" + std::string{request.getRemoteAddress()});
+            case RateLimitPolicy::Partition::Route:
+                if (auto endpoint = ctx.getRoutingData().getEndpoint())
+                {
+                    return _limiter.acquire(endpoint->getRouteTemplate());
+                }
+                return _limiter.acquire(request.getPath());
+            default:
+                return _limiter.acquire(request.getRemoteAddress());
+            }
+        }
+
+        static void reject(IResponse &response, std::chrono::nanoseconds wait)
+        {
+            TooManyRequestsResult{}.execute(response);
+            auto seconds = std::chrono::ceil<std::chrono::seconds>(wait).count();
+            response.getHeaders().set("Retry-After", std::to_string(seconds));
+        }
+    };
+
+    class RateLimiterMiddlewareCreator final : public IMiddlewareCreator
+    {
+      private:
+        RateLimitPolicy _policy;
+
+      public:
+        explicit RateLimiterMiddlewareCreator(RateLimitPolicy policy) : _policy(std::move(policy)) {}
+
+        MiddlewareLifetime getLifetime() const final { return MiddlewareLifetime::Singleton; }
+
+        IMiddleware::Ptr createSingleton() final { return std::make_unique<RateLimiterMiddleware>(_policy); }
+
+        IMiddleware::Ptr create(IContext &ctx) final { return createSingleton(); }
+
+        bool provides(const std::type_info &middleware) const final
+        {
+            return middleware == typeid(RateLimiterMiddleware);
+        }
+    };
+} // namespace sd
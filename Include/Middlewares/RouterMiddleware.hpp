@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <typeinfo>
+#include <utility>
+
+#include "Engine/IEndpoint.hpp"
+#include "Http/HttpMethod.hpp"
+#include "Http/IRequest.hpp"
+#include "Middlewares/IMiddleware.hpp"
+#include "Middlewares/MiddlewareCreator.hpp"
+#include "Router/IRouter.hpp"
+
+namespace sd
+{
+
+    class RouterMiddleware final : public IMiddleware
+    {
+      private:
+        IRouter *_router;
+
+      public:
+        RouterMiddleware(IRouter *router) : _router(router) {}
+
+        void next(IContext &ctx, INextCallback &callback) final { handle(ctx, callback); }
+
+        template <class NextCallback> void handle(IContext &ctx, NextCallback &callback)
+        {
+            auto &request = ctx.getRequest();
+            auto path = request.getPath();
+            auto match = _router->match(request.getMethod(), path);
+
+            ctx.getRoutingData().setMatch(std::move(path), match);
+
+            callback.next();
+        }
+    };
+
+    class RouterMiddlewareCreator final : public IMiddlewareCreator
+    {
+
+      private:
+        IRouter *_router;
+
+      public:
+        using Ptr = std::unique_ptr<RouterMiddlewareCreator>;
+
+        RouterMiddlewareCreator(IRouter *router) : _router(router) {}
+
+        MiddlewareLifetime getLifetime() const final { return MiddlewareLifetime::Singleton; }
+
+        IMiddleware::Ptr createSingleton() final { return std::make_unique<RouterMiddleware>(_router); }
+
+        IMiddleware::Ptr create(IContext &ctx) final { return createSingleton(); }
+
+        bool provides(const std::type_info &middleware) const final { return middleware == typeid(RouterMiddleware); }
+    };
+} // namespace sd
\ No newline at end of file
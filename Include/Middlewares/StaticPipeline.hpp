@@ -0,0 +1,111 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+
+#include "Engine/IContext.hpp"
+#include "Middlewares/IMiddleware.hpp"
+#include "Middlewares/IMiddlewareCreator.hpp"
+#include "Router/IRouter.hpp"
+
+namespace sd
+{
+    // Middlewares composed at compile time, each step calls the next one directly. Middleware can provide
+    // template <class NextCallback> void handle(IContext &, NextCallback &) to avoid virtual calls entirely,
+    // otherwise IMiddleware::next is used with final callback type
+    template <class... MiddlewaresT> class StaticPipeline final : public IMiddleware
+    {
+      private:
+        template <class MiddlewareT> struct Slot
+        {
+            MiddlewareT middleware;
+
+            explicit Slot(IRouter *router)
+                requires std::constructible_from<MiddlewareT, IRouter *>
+                : middleware(router)
+            {
+            }
+
+            explicit Slot(IRouter *)
+                requires(!std::constructible_from<MiddlewareT, IRouter *>)
+            {
+            }
+        };
+
+        template <size_t Index> struct Step final : INextCallback
+        {
+            StaticPipeline &pipeline;
+            IContext &ctx;
+            INextCallback &last;
+
+            Step(StaticPipeline &pipeline, IContext &ctx, INextCallback &last)
+                : pipeline(pipeline), ctx(ctx), last(last)
+            {
+            }
+
+            void next() final { pipeline.template run<Index + 1>(ctx, last); }
+        };
+
+        std::tuple<Slot<MiddlewaresT>...> _slots;
+
+      public:
+        explicit StaticPipeline(IRouter *router = nullptr) : _slots(((void)sizeof(MiddlewaresT), router)...)
+        {
+            static_assert((std::is_base_of_v<IMiddleware, MiddlewaresT> && ...),
+                          "Pipeline types must inherit from IMiddleware");
+        }
+
+        void next(IContext &ctx, INextCallback &callback) final { run<0>(ctx, callback); }
+
+        template <class MiddlewareT> static constexpr bool contains()
+        {
+            return (std::is_same_v<MiddlewareT, MiddlewaresT> || ...);
+        }
+
+      private:
+        template <size_t Index> void run(IContext &ctx, INextCallback &last)
+        {
+            if constexpr (Index == sizeof...(MiddlewaresT))
+            {
+                last.next();
+            }
+            else
+            {
+                auto &middleware = std::get<Index>(_slots).middleware;
+                Step<Index> step{*this, ctx, last};
+                if constexpr (requires { middleware.handle(ctx, step); })
+                {
+                    middleware.handle(ctx, step);
+                }
+                else
+                {
+                    middleware.next(ctx, step);
+                }
+            }
+        }
+    };
+
+    template <class... MiddlewaresT> class StaticPipelineCreator final : public IMiddlewareCreator
+    {
+      private:
+        IRouter *_router;
+
+      public:
+        StaticPipelineCreator(IRouter *router) : _router(router) {}
+
+        MiddlewareLifetime getLifetime() const final { return MiddlewareLifetime::Singleton; }
+
+        IMiddleware::Ptr createSingleton() final { return std::make_unique<StaticPipeline<MiddlewaresT...>>(_router); }
+
+        IMiddleware::Ptr create(IContext &ctx) final { return createSingleton(); }
+
+        bool provides(const std::type_info &middleware) const final
+        {
+            return ((middleware == typeid(MiddlewaresT)) || ...);
+        }
+    };
+} // namespace sd
@@ -17,6 +17,15 @@ namespace sd
         }
     };
 
+    struct TooManyRouteParams : public std::runtime_error
+    {
+        TooManyRouteParams(std::string_view templateRoute, size_t max)
+            : std::runtime_error{std::string{"Template route: '"} + std::string{templateRoute} + "' has more than " +
+                                 std::to_string(max) + " params."}
+        {
+        }
+    };
+
     struct BadPath : public std::runtime_error
     {
         BadPath(std::string_view path)
@@ -6,6 +6,7 @@
 #include "Engine/IEndpoint.hpp"
 #include "Http/IRequest.hpp"
 #include "Middlewares/IMiddleware.hpp"
+#include "Router/RouteMatch.hpp"
 
 namespace sd
 {
@@ -18,7 +19,7 @@ namespace sd
 
         virtual void compile() = 0;
 
-        virtual const IEndpoint *match(HttpMethod method, std::string_view path) const = 0;
+        virtual RouteMatch match(HttpMethod method, std::string_view path) const = 0;
 
         virtual ~IRouter() = default;
     };
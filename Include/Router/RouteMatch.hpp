@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Engine/IEndpoint.hpp"
+
+namespace sd
+{
+    // Result of routing: matched endpoint and values of route params stored as offsets into matched path,
+    // values are indexed by param position in route template
+    class RouteMatch
+    {
+      public:
+        static constexpr size_t MaxParams = 16;
+
+        struct Value
+        {
+            uint32_t offset = 0;
+            uint32_t length = 0;
+        };
+
+      private:
+        const IEndpoint *_endpoint = nullptr;
+        std::array<Value, MaxParams> _values;
+        size_t _size = 0;
+
+      public:
+        RouteMatch() = default;
+        RouteMatch(const IEndpoint *endpoint) : _endpoint(endpoint) {}
+
+        const IEndpoint *getEndpoint() const { return _endpoint; }
+
+        void setEndpoint(const IEndpoint *endpoint) { _endpoint = endpoint; }
+
+        explicit operator bool() const { return _endpoint != nullptr; }
+
+        const IEndpoint *operator->() const { return _endpoint; }
+
+        size_t size() const { return _size; }
+
+        const Value &at(size_t index) const { return _values.at(index); }
+
+        std::string_view getValue(std::string_view path, size_t index) const
+        {
+            auto &value = at(index);
+            return path.substr(value.offset, value.length);
+        }
+
+        void addValue(size_t offset, size_t length)
+        {
+            _values.at(_size++) = {static_cast<uint32_t>(offset), static_cast<uint32_t>(length)};
+        }
+
+        // drops values added after given size, used when router backtracks
+        void resize(size_t size) { _size = size; }
+    };
+} // namespace sd
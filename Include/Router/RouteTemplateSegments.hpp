@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <regex>
 #include <stdexcept>
 #include <variant>
@@ -28,11 +29,19 @@ namespace sd
     {
       private:
         std::vector<RouteTemplateSegment> _segments;
+        std::vector<std::string> _paramNames;
 
       public:
         RouteTemplateSegments(std::string_view routeTemplate)
         {
             _segments = createRouteTemplateSegments(routeTemplate);
+            for (auto &segment : _segments)
+            {
+                if (auto param = std::get_if<RouteParam>(&segment))
+                {
+                    _paramNames.push_back(param->name);
+                }
+            }
         }
 
         auto begin() const { return _segments.begin(); }
@@ -42,6 +51,21 @@ namespace sd
 
         const RouteTemplateSegment &at(size_t index) const { return _segments.at(index); }
 
+        // route params names in order of appearance
+        const std::vector<std::string> &getParamNames() const { return _paramNames; }
+
+        std::optional<size_t> findParamIndex(std::string_view name) const
+        {
+            for (size_t i = 0; i < _paramNames.size(); ++i)
+            {
+                if (_paramNames[i] == name)
+                {
+                    return i;
+                }
+            }
+            return std::nullopt;
+        }
+
       private:
         std::vector<RouteTemplateSegment> createRouteTemplateSegments(std::string_view path)
         {
@@ -17,14 +17,6 @@ namespace sd
 
         void compile() { _tree.compile(); };
 
-        const IEndpoint *match(HttpMethod method, std::string_view path) const
-        {
-            auto splitted = utils::split(path);
-            if (auto endpoint = _tree.match(method, splitted))
-            {
-                return endpoint;
-            }
-            return nullptr;
-        }
+        RouteMatch match(HttpMethod method, std::string_view path) const { return _tree.match(method, path); }
     };
 } // namespace sd
\ No newline at end of file
@@ -13,11 +13,15 @@ namespace sd
     {
       private:
         ISegmentMatcher::Ptr _matcher;
+        bool _isParam = false;
         std::unordered_map<HttpMethod, IEndpoint::Ptr> _endpointsMap;
         std::vector<RoutingNode> _children;
 
       public:
-        RoutingNode(ISegmentMatcher::Ptr matcher) : _matcher(std::move(matcher)) {}
+        RoutingNode(ISegmentMatcher::Ptr matcher, bool isParam = false)
+            : _matcher(std::move(matcher)), _isParam(isParam)
+        {
+        }
 
         RoutingNode(RoutingNode &&) = default;
         RoutingNode &operator=(RoutingNode &&) = default;
@@ -54,6 +58,9 @@ namespace sd
 
         bool match(std::string_view segment) const { return _matcher->match(segment); }
 
+        // segment value is captured as route param
+        bool isParam() const { return _isParam; }
+
         auto begin() { return _children.begin(); }
         auto begin() const { return _children.begin(); }
         auto end() { return _children.end(); }
@@ -11,7 +11,9 @@
 #include "Common/Utils.hpp"
 #include "Engine/IEndpoint.hpp"
 #include "Http/HttpMethod.hpp"
+#include "Router/Exceptions.hpp"
 #include "Router/ISegmentMatcher.hpp"
+#include "Router/RouteMatch.hpp"
 #include "Router/RouteTemplateSegments.hpp"
 #include "Router/RoutingNode.hpp"
 #include "Router/SegmentMatchers.hpp"
@@ -23,25 +25,37 @@ namespace sd
     {
       private:
         using Endpoints = std::vector<IEndpoint::Ptr>;
-        using RouteSegments = std::vector<std::string_view>;
 
         RoutingNode _root{std::make_unique<StringSegmentMatcher>("")};
         Endpoints _endpoints;
 
       public:
-        IEndpoint *add(IEndpoint::Ptr endpoint) { return _endpoints.emplace_back(std::move(endpoint)).get(); }
+        IEndpoint *add(IEndpoint::Ptr endpoint)
+        {
+            if (endpoint->getRouteTemplateSegments().getParamNames().size() > RouteMatch::MaxParams)
+            {
+                throw TooManyRouteParams{endpoint->getRouteTemplate(), RouteMatch::MaxParams};
+            }
+            return _endpoints.emplace_back(std::move(endpoint)).get();
+        }
 
-        const IEndpoint *match(HttpMethod method, const RouteSegments &routeSegments) const
+        // Path segments are visited in place, param values are captured on the way
+        RouteMatch match(HttpMethod method, std::string_view path) const
         {
-            if (routeSegments.empty())
+            RouteMatch result;
+            if (!getMatching(_root, method, path, 0, result))
             {
-                return nullptr;
+                return {};
             }
-            return getMatching(_root, method, routeSegments, 0);
+            return result;
         }
 
         void compile()
         {
+            for (auto &endpoint : _endpoints)
+            {
+                endpoint->compile();
+            }
             _root.setChilderen(createRoutingNodes(std::move(_endpoints), 0));
             sortNodesByPrecedence(_root);
         }
@@ -57,25 +71,44 @@ namespace sd
             }
         }
 
-        const IEndpoint *getMatching(const RoutingNode &node, HttpMethod method, const RouteSegments &routeSegments,
-                                     int depth) const
+        bool getMatching(const RoutingNode &node, HttpMethod method, std::string_view path, size_t begin,
+                         RouteMatch &result) const
         {
-            if (!node.match(routeSegments[depth]))
+            auto end = path.find('/', begin);
+            auto isLast = end == std::string_view::npos;
+            if (isLast)
             {
-                return nullptr;
+                end = path.size();
             }
-            if (routeSegments.size() - 1 == depth)
+            if (!node.match(path.substr(begin, end - begin)))
             {
-                return node.getEndpoint(method);
+                return false;
             }
-            for (auto &child : node)
+            auto valuesSize = result.size();
+            if (node.isParam())
+            {
+                result.addValue(begin, end - begin);
+            }
+            if (isLast)
             {
-                if (auto matchingNode = getMatching(child, method, routeSegments, depth + 1))
+                result.setEndpoint(node.getEndpoint(method));
+            }
+            else
+            {
+                for (auto &child : node)
                 {
-                    return matchingNode;
+                    if (getMatching(child, method, path, end + 1, result))
+                    {
+                        return true;
+                    }
                 }
             }
-            return nullptr;
+            if (result)
+            {
+                return true;
+            }
+            result.resize(valuesSize);
+            return false;
         }
 
         std::vector<RoutingNode> createRoutingNodes(Endpoints allEndpoints, int depth) const
@@ -86,7 +119,8 @@ namespace sd
             for (auto &data : lookup)
             {
                 auto &[routeTemplateSegment, endpoints] = data;
-                RoutingNode node{createMatcher(routeTemplateSegment)};
+                RoutingNode node{createMatcher(routeTemplateSegment),
+                                 std::holds_alternative<RouteParam>(routeTemplateSegment)};
 
                 node.addEndpoints(moveOutMatchingDepthEndpoints(endpoints, depth));
                 node.setChilderen(createRoutingNodes(std::move(endpoints), depth + 1));
@@ -26,7 +26,7 @@ namespace sd
         bool match(std::string_view segment) const
         {
             bool res;
-            return utils::tryConvert(std::string{segment}, res);
+            return utils::tryConvert(segment, res);
         }
         int precedence() const { return 130; }
     };
@@ -37,7 +37,7 @@ namespace sd
         bool match(std::string_view segment) const
         {
             float res;
-            return utils::tryConvert(std::string{segment}, res);
+            return utils::tryConvert(segment, res);
         }
         int precedence() const { return 120; }
     };
@@ -48,7 +48,7 @@ namespace sd
         bool match(std::string_view segment) const
         {
             double res;
-            return utils::tryConvert(std::string{segment}, res);
+            return utils::tryConvert(segment, res);
         }
         int precedence() const { return 110; }
     };
@@ -59,7 +59,7 @@ namespace sd
         bool match(std::string_view segment) const
         {
             int res;
-            return utils::tryConvert(std::string{segment}, res);
+            return utils::tryConvert(segment, res);
         }
         int precedence() const { return 100; }
     };
@@ -94,7 +94,7 @@ namespace sd
         bool match(std::string_view segment) const
         {
             int i;
-            if (!utils::tryConvert(std::string{segment}, i))
+            if (!utils::tryConvert(segment, i))
             {
                 return false;
             }
@@ -112,7 +112,7 @@ namespace sd
         bool match(std::string_view segment) const
         {
             int i;
-            if (!utils::tryConvert(std::string{segment}, i))
+            if (!utils::tryConvert(segment, i))
             {
                 return false;
             }
@@ -131,7 +131,7 @@ namespace sd
         bool match(std::string_view segment) const
         {
             int i;
-            if (!utils::tryConvert(std::string{segment}, i))
+            if (!utils::tryConvert(segment, i))
             {
                 return false;
             }
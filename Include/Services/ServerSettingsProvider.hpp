@@ -14,6 +14,11 @@ namespace sd
         static inline const std::string ThreadsNumber = "threadsNumber";
         static inline const std::string Url = "url";
         static inline const std::string DefaultUrl = "http://localhost:9090";
+        static inline const std::string CertificateFile = "certificateFile";
+        static inline const std::string PrivateKeyFile = "privateKeyFile";
+        static inline const std::string Certificates = "certificates";
+        static inline const std::string Hosts = "hosts";
+        static inline const std::string CertificateWatchIntervalSec = "certificateWatchIntervalSec";
 
         IConfiguration &_configuration;
         ServerSettings _settings;
@@ -32,6 +37,7 @@ namespace sd
         {
             setUrls();
             setThreadsNumber();
+            setCertificates();
         }
 
         void setUrls()
@@ -58,6 +64,64 @@ namespace sd
             }
         }
 
+        void setCertificates()
+        {
+            if (_settings.certificateFile.empty())
+            {
+                _settings.certificateFile = tryGetStringFromConfig(CertificateFile);
+            }
+            if (_settings.privateKeyFile.empty())
+            {
+                _settings.privateKeyFile = tryGetStringFromConfig(PrivateKeyFile);
+            }
+            if (_settings.certificates.empty())
+            {
+                _settings.certificates = tryGetCertificatesFromConfig();
+            }
+            if (!_settings.certificateWatchIntervalSec)
+            {
+                if (auto interval = _configuration.find(CertificateWatchIntervalSec); interval && interval->is_number())
+                {
+                    _settings.certificateWatchIntervalSec = interval->as<size_t>();
+                }
+            }
+        }
+
+        std::vector<CertificateSettings> tryGetCertificatesFromConfig()
+        {
+            std::vector<CertificateSettings> result;
+            auto certificates = _configuration.find(Certificates);
+            if (!certificates || !certificates->is_array())
+            {
+                return result;
+            }
+            for (auto &certificate : certificates->get_array())
+            {
+                auto &settings = result.emplace_back();
+                settings.certificateFile = getString(certificate.find(CertificateFile));
+                settings.privateKeyFile = getString(certificate.find(PrivateKeyFile));
+                if (auto hosts = certificate.find(Hosts); hosts && hosts->is_array())
+                {
+                    for (auto &host : hosts->get_array())
+                    {
+                        settings.hosts.push_back(getString(&host));
+                    }
+                }
+            }
+            return result;
+        }
+
+        std::string tryGetStringFromConfig(const std::string &key) { return getString(_configuration.find(key)); }
+
+        static std::string getString(const Json *value)
+        {
+            if (value && value->is_string_type())
+            {
+                return std::string{value->get_string_type()};
+            }
+            return {};
+        }
+
         std::vector<std::string> tryGetUrlFromConfig()
         {
             std::vector<std::string> result;
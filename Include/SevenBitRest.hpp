@@ -1,3 +1,4 @@
 #pragma once
 
-#include "Engine/WebApplicationBuilder.hpp"
+#include "Engine/TestServer.hpp"
+#include "Engine/WebApplicationBuilder.hpp"
\ No newline at end of file
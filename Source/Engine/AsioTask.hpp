@@ -0,0 +1,34 @@
+#pragma once
+
+#include <boost/asio/associated_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "Common/Task.hpp"
+
+namespace sd
+{
+    // Awaits task inside asio coroutine, task code follows its own executor, completion is dispatched back to
+    // executor of awaiting asio coroutine
+    template <class T> auto awaitTask(Task<T> task)
+    {
+        using Executor = boost::asio::io_context::executor_type;
+        auto initiation = [](auto handler, Task<T> task) {
+            auto executor = boost::asio::get_associated_executor(handler);
+            startTask(std::move(task), [handler = std::move(handler), executor](std::exception_ptr exception,
+                                                                                std::optional<T> result) mutable {
+                boost::asio::dispatch(executor, [handler = std::move(handler), exception,
+                                                 result = std::move(result)]() mutable {
+                    std::move(handler)(exception, result ? std::move(*result) : T{});
+                });
+            });
+        };
+        return boost::asio::async_initiate<const boost::asio::use_awaitable_t<Executor>, void(std::exception_ptr, T)>(
+            initiation, boost::asio::use_awaitable_t<Executor>{}, std::move(task));
+    }
+} // namespace sd
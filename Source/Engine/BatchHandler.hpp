@@ -0,0 +1,311 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tao/json/from_string.hpp>
+#include <tao/json/msgpack.hpp>
+#include <utility>
+#include <vector>
+
+#include "Common/Json.hpp"
+#include "Common/Task.hpp"
+#include "Common/Utils.hpp"
+#include "Engine/BatchOptions.hpp"
+#include "Engine/BoostBeastServer.hpp"
+#include "Engine/ConnectionInfo.hpp"
+#include "Engine/IContext.hpp"
+#include "Http/IRequest.hpp"
+#include "Http/IResponse.hpp"
+#include "Http/Results.hpp"
+
+namespace sd
+{
+    // Runs sub-requests of one POST through the whole pipeline in process. Body is JSON (or msgpack) array of
+    // {"method": "GET", "path": "/users/1?fields=name", "headers": {...}, "body": ...}, response is array of
+    // {"status": 200, "headers": {...}, "body": ...} in the same order and format, repeated response headers are
+    // arrays of values. Sub-requests inherit caller
+    // describing headers of batch request (InheritedHeaders, for example Authorization) unless they set them
+    class BatchHandler
+    {
+      private:
+        static inline const std::string MsgPackType = "application/msgpack";
+
+        // describe caller rather than batch request, conditional or encoding headers of batch would change
+        // unrelated sub-requests
+        static constexpr std::array<std::string_view, 9> InheritedHeaders = {
+            "Authorization", "Cookie", "Accept", "Accept-Language", "User-Agent", "Forwarded", "X-Forwarded-For",
+            "X-Forwarded-Proto", "X-Forwarded-Host"};
+
+        BatchOptions _options;
+        ServerRequestHandler _handler;
+
+        // Awaited after starting all sub-requests, resumes once all completed
+        class Countdown
+        {
+          private:
+            std::atomic<size_t> _remaining;
+            std::coroutine_handle<> _waiter;
+
+          public:
+            explicit Countdown(size_t count) : _remaining(count + 1) {}
+
+            void signal()
+            {
+                if (_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    _waiter.resume();
+                }
+            }
+
+            bool await_ready() { return false; }
+
+            bool await_suspend(std::coroutine_handle<> waiter)
+            {
+                _waiter = waiter;
+                return _remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+            }
+
+            void await_resume() {}
+        };
+
+      public:
+        BatchHandler(BatchOptions options, ServerRequestHandler handler)
+            : _options(options), _handler(std::move(handler))
+        {
+        }
+
+        Task<> handle(IContext &ctx)
+        {
+            auto &request = ctx.getRequest();
+            if (request.isBatched())
+            {
+                // checked on routed request, so encoded or aliased paths of batch endpoint are rejected too
+                auto detail = "Batch can not contain batch requests.";
+                ProblemResult{400, getProblemTitle(400), detail}.execute(ctx.getResponse());
+                co_return;
+            }
+            auto contentType = request.getContentType();
+            auto msgPack = utils::iequals(contentType.substr(0, contentType.find(';')), MsgPackType);
+            Json batch;
+            try
+            {
+                batch = msgPack ? tao::json::msgpack::basic_from_string<JsonTraits>(request.getBody())
+                                : tao::json::basic_from_string<JsonTraits>(request.getBody());
+            }
+            catch (const std::exception &e)
+            {
+                ProblemResult{400, getProblemTitle(400), e.what()}.execute(ctx.getResponse());
+                co_return;
+            }
+            if (!batch.is_array())
+            {
+                ProblemResult{400, getProblemTitle(400), "Batch must be an array."}.execute(ctx.getResponse());
+                co_return;
+            }
+            auto &items = batch.get_array();
+            if (items.size() > _options.maxRequests)
+            {
+                auto detail = "Batch has more than " + std::to_string(_options.maxRequests) + " requests.";
+                ProblemResult{400, getProblemTitle(400), detail}.execute(ctx.getResponse());
+                co_return;
+            }
+
+            // arrival time is set when each sub-request is dispatched, so sequential ones do not count time spent
+            // in earlier ones as queueing delay
+            ConnectionInfo connection{.remoteAddress = std::string{request.getRemoteAddress()},
+                                      .remotePort = request.getRemotePort(),
+                                      .batched = true};
+            std::vector<NativeRequest> subRequests(items.size());
+            std::vector<std::optional<NativeResponse>> responses(items.size());
+            for (size_t i = 0; i < items.size(); ++i)
+            {
+                if (auto error = createSubRequest(request, items[i], subRequests[i]))
+                {
+                    responses[i] = createError(*error, subRequests[i].version());
+                }
+            }
+            if (_options.parallel)
+            {
+                co_await runParallel(subRequests, responses, connection);
+            }
+            else
+            {
+                for (size_t i = 0; i < subRequests.size(); ++i)
+                {
+                    if (!responses[i])
+                    {
+                        connection.arrivalTime = std::chrono::steady_clock::now();
+                        responses[i] = co_await _handler(subRequests[i], connection);
+                    }
+                }
+            }
+            writeResults(ctx.getResponse(), responses, msgPack);
+        }
+
+      private:
+        Task<> runParallel(std::vector<NativeRequest> &subRequests,
+                           std::vector<std::optional<NativeResponse>> &responses, ConnectionInfo &connection)
+        {
+            Countdown countdown{subRequests.size()};
+            connection.arrivalTime = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < subRequests.size(); ++i)
+            {
+                if (responses[i])
+                {
+                    countdown.signal();
+                    continue;
+                }
+                startTask(_handler(subRequests[i], connection),
+                          [&, i](std::exception_ptr, std::optional<NativeResponse> response) {
+                              responses[i] = std::move(response);
+                              countdown.signal();
+                          });
+            }
+            co_await countdown;
+        }
+
+        // error message when item is invalid
+        std::optional<std::string> createSubRequest(const IRequest &batchRequest, const Json &item,
+                                                    NativeRequest &subRequest) const
+        {
+            namespace http = boost::beast::http;
+            if (!item.is_object())
+            {
+                return "Request must be an object.";
+            }
+            auto method = item.find("method");
+            auto path = item.find("path");
+            if (!path || !path->is_string() || !path->get_string().starts_with('/'))
+            {
+                return "Request path must be a string starting with '/'.";
+            }
+            auto verb = method && method->is_string() ? http::string_to_verb(method->get_string()) : http::verb::get;
+            if (verb == http::verb::unknown)
+            {
+                return "Request method is not supported.";
+            }
+            subRequest.method(verb);
+            subRequest.target(path->get_string());
+            subRequest.version(11);
+            batchRequest.getHeaders().forEach([&](std::string_view name, std::string_view value) {
+                if (isInherited(name))
+                {
+                    subRequest.insert(name, value);
+                }
+                return IParamsView::Continue;
+            });
+            if (auto headers = item.find("headers"); headers && headers->is_object())
+            {
+                for (auto &[name, value] : headers->get_object())
+                {
+                    if (value.is_string())
+                    {
+                        subRequest.set(name, value.get_string());
+                    }
+                }
+            }
+            if (auto body = item.find("body"); body && !body->is_null())
+            {
+                if (body->is_string())
+                {
+                    subRequest.body() = body->get_string();
+                }
+                else
+                {
+                    subRequest.body() = tao::json::to_string(*body);
+                    if (subRequest.find(http::field::content_type) == subRequest.end())
+                    {
+                        subRequest.set(http::field::content_type, "application/json");
+                    }
+                }
+            }
+            subRequest.prepare_payload();
+            return std::nullopt;
+        }
+
+        static bool isInherited(std::string_view name)
+        {
+            return std::any_of(InheritedHeaders.begin(), InheritedHeaders.end(),
+                               [&](std::string_view inherited) { return utils::iequals(name, inherited); });
+        }
+
+        static NativeResponse createError(const std::string &detail, unsigned version)
+        {
+            NativeResponse response{boost::beast::http::status::bad_request, version};
+            response.set(boost::beast::http::field::content_type, "application/problem+json");
+            response.body() = BufferChain{ProblemResult::createBody(400, getProblemTitle(400), detail)};
+            return response;
+        }
+
+        static void writeResults(IResponse &response, std::vector<std::optional<NativeResponse>> &responses,
+                                 bool msgPack)
+        {
+            Json results = Json::array_t{};
+            results.get_array().reserve(responses.size());
+            for (auto &subResponse : responses)
+            {
+                results.get_array().push_back(subResponse ? toJson(*subResponse) : Json{{"status", 500}});
+            }
+            response.setStatusCode(200);
+            if (msgPack)
+            {
+                response.getHeaders().set("Content-Type", MsgPackType);
+                response.setBody(tao::json::msgpack::to_string(results));
+                return;
+            }
+            response.getHeaders().set("Content-Type", "application/json; charset=utf-8");
+            response.setBody(tao::json::to_string(results));
+        }
+
+        // JSON bodies are embedded as values, others as strings
+        static Json toJson(NativeResponse &response)
+        {
+            Json headers = Json::object_t{};
+            for (auto &field : response.base())
+            {
+                auto name = field.name_string();
+                if (utils::iequals(name, "Date") || utils::iequals(name, "Content-Length"))
+                {
+                    continue;
+                }
+                // repeated headers become arrays, joining them would corrupt values containing commas (Set-Cookie)
+                auto &value = headers[std::string{name}];
+                if (value.is_string())
+                {
+                    value = Json::array_t{std::move(value), Json(std::string{field.value()})};
+                }
+                else if (value.is_array())
+                {
+                    value.get_array().emplace_back(std::string{field.value()});
+                }
+                else
+                {
+                    value = field.value();
+                }
+            }
+            auto body = response.body().toString();
+            Json result = {{"status", response.result_int()}, {"headers", std::move(headers)}};
+            auto contentType = response.base()[boost::beast::http::field::content_type];
+            if (!body.empty() && contentType.find("json") != std::string_view::npos)
+            {
+                try
+                {
+                    result["body"] = tao::json::basic_from_string<JsonTraits>(body);
+                    return result;
+                }
+                catch (const std::exception &)
+                {
+                }
+            }
+            result["body"] = std::move(body);
+            return result;
+        }
+    };
+} // namespace sd
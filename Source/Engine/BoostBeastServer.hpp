@@ -12,7 +12,9 @@
 #include <boost/asio/dispatch.hpp>
 #include <boost/asio/experimental/as_tuple.hpp>
 #include <boost/asio/experimental/parallel_group.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/signal_set.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/strand.hpp>
 #include <boost/asio/use_awaitable.hpp>
 #include <boost/beast/core.hpp>
@@ -24,19 +26,25 @@
 #include <boost/optional.hpp>
 #include <cstdlib>
 #include <functional>
-#include <iostream>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "Common/ServerSettings.hpp"
+#include "Common/Task.hpp"
+#include "Engine/AsioTask.hpp"
 #include "Engine/BoostExtensions.hpp"
 #include "Engine/CancellationSignals.hpp"
-#include "Engine/CertLoader.hpp"
+#include "Engine/ConnectionInfo.hpp"
+#include "Engine/ProxyProtocol.hpp"
+#include "Engine/ServerExecutor.hpp"
+#include "Engine/SslContextProvider.hpp"
 #include "Engine/Url.hpp"
+#include "Http/BufferChainBody.hpp"
 #include "Log/ILogger.hpp"
 
 namespace sd
@@ -47,10 +55,11 @@ namespace sd
 
     using NativeRequest = boost::beast::http::request<boost::beast::http::string_body>;
     using NativeRequestHeaders = NativeRequest::header_type;
-    using NativeResponse = boost::beast::http::response<boost::beast::http::string_body>;
+    using NativeResponse = boost::beast::http::response<BufferChainBody>;
     using NativeResponseHeaders = NativeResponse::header_type;
     using NativeParamList = boost::beast::http::param_list;
-    using ServerRequestHandler = std::function<NativeResponse(NativeRequest &)>;
+    using NativeFields = boost::beast::http::fields;
+    using ServerRequestHandler = std::function<Task<NativeResponse>(NativeRequest &, const ConnectionInfo &)>;
 
     class BoostBeastServer
     {
@@ -59,10 +68,15 @@ namespace sd
         ServerRequestHandler _handler;
         const ServerSettings _settings;
         CancellationSignals _cancellation;
+        SslContextProvider _sslContexts;
+        ServerExecutor _executor;
+        std::mutex _contextMutex;
+        boost::asio::io_context *_context = nullptr; // running context, guarded so stop does not outlive it
 
       public:
         BoostBeastServer(ILogger &logger, ServerRequestHandler handler, ServerSettings settings)
-            : _logger(logger.createFor<BoostBeastServer>()), _handler(handler), _settings(settings)
+            : _logger(logger.createFor<BoostBeastServer>()), _handler(handler), _settings(settings),
+              _sslContexts(_settings)
         {
         }
 
@@ -72,11 +86,10 @@ namespace sd
 
             // The io_context is required for all I/O
             boost::asio::io_context ioc{threads};
+            _executor.attach(ioc);
+            setContext(&ioc);
 
-            // The SSL context is required, and holds certificates
-            boost::asio::ssl::context sslCtx{boost::asio::ssl::context::tlsv12};
             bool certLoaded = false;
-            // This holds the self-signed certificate used by the server
 
             for (auto urlSettings : urls)
             {
@@ -87,31 +100,43 @@ namespace sd
                 auto const address = boost::asio::ip::make_address(urlSettings.host);
                 auto const port = urlSettings.port;
                 auto const useSsl = urlSettings.useSsl;
+                auto const useProxyProtocol = urlSettings.useProxyProtocol;
 
                 if (useSsl && !certLoaded)
                 {
                     certLoaded = true;
-                    CertLoader::load(sslCtx);
+                    // load eagerly so certificate errors are reported on startup
+                    _sslContexts.get();
+                    if (_settings.certificateWatchIntervalSec && _sslContexts.usesFiles())
+                    {
+                        boost::asio::co_spawn(
+                            ioc, watchCertificates(),
+                            boost::asio::bind_cancellation_slot(_cancellation.slot(), boost::asio::detached));
+                    }
                 }
 
                 // Create and launch a listening routine
+                auto const endpoint = boost::asio::ip::tcp::endpoint{address, port};
                 if (useSsl)
                 {
                     boost::asio::co_spawn(
-                        ioc, listen(sslCtx, boost::asio::ip::tcp::endpoint{address, port}, _cancellation),
+                        ioc, listen(_sslContexts, endpoint, useProxyProtocol, _cancellation),
                         boost::asio::bind_cancellation_slot(_cancellation.slot(), boost::asio::detached));
                 }
                 else
                 {
                     boost::asio::co_spawn(
-                        ioc, listen(ioc, boost::asio::ip::tcp::endpoint{address, port}, _cancellation),
+                        ioc, listen(ioc, endpoint, useProxyProtocol, _cancellation),
                         boost::asio::bind_cancellation_slot(_cancellation.slot(), boost::asio::detached));
                 }
             }
 
             // Capture SIGINT and SIGTERM to perform a clean shutdown
+            // wait is cancelled by stop, so run returns once listeners and sessions finished
             boost::asio::signal_set signals(ioc, SIGINT, SIGTERM);
-            signals.async_wait([&](boost::beast::error_code const &, int sig) {
+            auto onSignal = [&](boost::beast::error_code const &ec, int sig) {
+                if (ec)
+                    return;
                 if (sig == SIGINT)
                     _cancellation.emit(boost::asio::cancellation_type::all);
                 else
@@ -121,7 +146,8 @@ namespace sd
                     // `io_context` and all of the sockets in it.
                     ioc.stop();
                 }
-            });
+            };
+            signals.async_wait(boost::asio::bind_cancellation_slot(_cancellation.slot(), onSignal));
 
             // Run the I/O service on the requested number of threads
             std::vector<std::thread> v;
@@ -136,16 +162,42 @@ namespace sd
             for (auto &t : v)
                 t.join();
 
+            setContext(nullptr);
+            _executor.detach();
             return EXIT_SUCCESS;
         }
 
-        void stop() { _cancellation.emit(); }
+        // Stops listeners and cancels sessions on server thread, start returns once they finished
+        void stop()
+        {
+            std::lock_guard lock{_contextMutex};
+            if (_context)
+            {
+                boost::asio::post(*_context, [this] { _cancellation.emit(); });
+            }
+        }
+
+        IExecutor &getExecutor() { return _executor; }
+
+        // New TLS handshakes use reloaded certificate, already established connections are not affected
+        void reloadCertificates()
+        {
+            _sslContexts.reload();
+            _logger->logInfo("TLS certificate reloaded");
+        }
 
       private:
+        void setContext(boost::asio::io_context *context)
+        {
+            std::lock_guard lock{_contextMutex};
+            _context = context;
+        }
+
         // Accepts incoming connections and launches the sessions.
         template <class Context>
         BOOST_ASIO_NODISCARD boost::asio::awaitable<void, executor_type> listen(Context &ctx,
                                                                                 boost::asio::ip::tcp::endpoint endpoint,
+                                                                                bool useProxyProtocol,
                                                                                 CancellationSignals &sig)
         {
             typename boost::asio::ip::tcp::acceptor::rebind_executor<executor_with_default>::other acceptor{
@@ -161,7 +213,7 @@ namespace sd
                 using stream_type = typename boost::beast::tcp_stream::rebind_executor<executor_with_default>::other;
                 if (!ec)
                     // We dont't need a strand, since the awaitable is an implicit strand.
-                    boost::asio::co_spawn(exec, detectSession(stream_type(std::move(sock)), ctx),
+                    boost::asio::co_spawn(exec, detectSession(stream_type(std::move(sock)), ctx, useProxyProtocol),
                                           boost::asio::bind_cancellation_slot(sig.slot(), boost::asio::detached));
             }
         }
@@ -207,24 +259,31 @@ namespace sd
 
         BOOST_ASIO_NODISCARD boost::asio::awaitable<void, executor_type> detectSession(
             typename boost::beast::tcp_stream::rebind_executor<executor_with_default>::other stream,
-            boost::asio::io_context &ctx)
+            boost::asio::io_context &, bool useProxyProtocol)
         {
             boost::beast::flat_buffer buffer;
+            auto info = getConnectionInfo(stream);
 
             // Set the timeout.
             stream.expires_after(std::chrono::seconds(_settings.timeoutSec));
+            if (useProxyProtocol && !co_await readProxyHeader(stream, buffer, info))
+                co_return;
             // on_run
-            co_await runSession(stream, buffer);
+            co_await runSession(stream, buffer, info);
         }
 
         BOOST_ASIO_NODISCARD boost::asio::awaitable<void, executor_type> detectSession(
             typename boost::beast::tcp_stream::rebind_executor<executor_with_default>::other stream,
-            boost::asio::ssl::context &ctx)
+            SslContextProvider &sslContexts, bool useProxyProtocol)
         {
             boost::beast::flat_buffer buffer;
+            auto info = getConnectionInfo(stream);
 
             // Set the timeout.
             stream.expires_after(std::chrono::seconds(_settings.timeoutSec));
+            // PROXY header is sent by the load balancer before TLS ClientHello
+            if (useProxyProtocol && !co_await readProxyHeader(stream, buffer, info))
+                co_return;
             // on_run
             auto [ec, result] = co_await boost::beast::async_detect_ssl(stream, buffer);
             // on_detect
@@ -234,17 +293,19 @@ namespace sd
             if (result)
             {
                 using stream_type = typename boost::beast::tcp_stream::rebind_executor<executor_with_default>::other;
-                boost::beast::ssl_stream<stream_type> ssl_stream{std::move(stream), ctx};
+                // session keeps its context alive even if certificates are reloaded meanwhile
+                auto contexts = sslContexts.get();
+                boost::beast::ssl_stream<stream_type> ssl_stream{std::move(stream), contexts->getDefault()};
 
-                auto [ec, bytes_used] = co_await ssl_stream.async_handshake(
+                auto [handshakeEc, bytes_used] = co_await ssl_stream.async_handshake(
                     boost::asio::ssl::stream_base::server, buffer.data(),
                     boost::asio::as_tuple(boost::asio::use_awaitable_t<executor_type>{}));
 
-                if (ec)
-                    co_return fail(ec, "handshake");
+                if (handshakeEc)
+                    co_return fail(handshakeEc, "handshake");
 
                 buffer.consume(bytes_used);
-                co_await runSession(ssl_stream, buffer);
+                co_await runSession(ssl_stream, buffer, info);
             }
             else
             {
@@ -252,15 +313,84 @@ namespace sd
             }
         }
 
+        BOOST_ASIO_NODISCARD boost::asio::awaitable<void, executor_type> watchCertificates()
+        {
+            boost::asio::steady_timer::rebind_executor<executor_with_default>::other timer{
+                co_await boost::asio::this_coro::executor};
+            while (true)
+            {
+                timer.expires_after(std::chrono::seconds(_settings.certificateWatchIntervalSec));
+                auto [ec] = co_await timer.async_wait();
+                if (ec)
+                    co_return;
+                try
+                {
+                    if (_sslContexts.reloadIfChanged())
+                        _logger->logInfo("TLS certificate files changed, certificate reloaded");
+                }
+                catch (std::exception &e)
+                {
+                    _logger->logError(std::string{"certificate reload: "} + e.what());
+                }
+            }
+        }
+
+        template <typename Stream> static ConnectionInfo getConnectionInfo(Stream &stream)
+        {
+            ConnectionInfo info;
+            boost::beast::error_code ec;
+            auto endpoint = stream.socket().remote_endpoint(ec);
+            if (!ec)
+            {
+                info.remoteAddress = endpoint.address().to_string();
+                info.remotePort = endpoint.port();
+            }
+            return info;
+        }
+
+        // Reads PROXY protocol header, bytes received after the header are left in the buffer for the next reader
+        template <typename Stream>
+        BOOST_ASIO_NODISCARD boost::asio::awaitable<bool, executor_type> readProxyHeader(
+            Stream &stream, boost::beast::flat_buffer &buffer, ConnectionInfo &info)
+        {
+            while (true)
+            {
+                auto data = buffer.data();
+                auto result =
+                    ProxyProtocol::parse({static_cast<const char *>(data.data()), data.size()}, info);
+                if (result.status == ProxyProtocol::Status::Complete)
+                {
+                    buffer.consume(result.headerSize);
+                    co_return true;
+                }
+                if (result.status == ProxyProtocol::Status::Invalid)
+                {
+                    _logger->logError("proxy: invalid PROXY protocol header");
+                    co_return false;
+                }
+                auto [ec, size] = co_await stream.async_read_some(buffer.prepare(512));
+                if (ec)
+                {
+                    fail(ec, "proxy");
+                    co_return false;
+                }
+                buffer.commit(size);
+            }
+        }
+
         template <typename Stream>
         BOOST_ASIO_NODISCARD boost::asio::awaitable<void, executor_type> runSession(Stream &stream,
-                                                                                    boost::beast::flat_buffer &buffer)
+                                                                                    boost::beast::flat_buffer &buffer,
+                                                                                    const ConnectionInfo &info)
         {
             boost::beast::http::request_parser<boost::beast::http::string_body> parser;
             // Apply a reasonable limit to the allowed size
             // of the body in bytes to prevent abuse.
             parser.body_limit(_settings.bodyLimit);
 
+            // taken before reading, so time request waited for busy I/O threads counts as its queueing delay
+            auto requestInfo = info;
+            requestInfo.arrivalTime = std::chrono::steady_clock::now();
             auto [ec, bytes_transferred] = co_await boost::beast::http::async_read(stream, buffer, parser);
 
             if (ec == boost::beast::http::error::end_of_stream)
@@ -289,12 +419,12 @@ namespace sd
                 // we follow a different strategy then the other example: instead of queue responses,
                 // we always to one read & write in parallel.
                 auto res = parser.release();
-                boost::beast::http::message_generator msg = _handler(res);
+                boost::beast::http::message_generator msg = co_await awaitTask(_handler(res, requestInfo));
                 // if (!msg.keep_alive())
                 // {
-                auto [ec, sz] = co_await boost::beast::async_write(stream, std::move(msg));
-                if (ec)
-                    fail(ec, "write");
+                auto [writeEc, sz] = co_await boost::beast::async_write(stream, std::move(msg));
+                if (writeEc)
+                    fail(writeEc, "write");
                 co_return;
                 // }
 
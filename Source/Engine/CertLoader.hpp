@@ -93,5 +93,16 @@ namespace sd
 
             ctx.use_tmp_dh(boost::asio::buffer(dh.data(), dh.size()));
         }
+
+        static void loadFromFiles(boost::asio::ssl::context &ctx, const std::string &certificateFile,
+                                  const std::string &privateKeyFile)
+        {
+            ctx.set_options(boost::asio::ssl::context::default_workarounds | boost::asio::ssl::context::no_sslv2 |
+                            boost::asio::ssl::context::single_dh_use);
+
+            ctx.use_certificate_chain_file(certificateFile);
+
+            ctx.use_private_key_file(privateKeyFile, boost::asio::ssl::context::file_format::pem);
+        }
     };
 } // namespace sd
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace sd
+{
+    struct ConnectionInfo
+    {
+        std::string remoteAddress;
+        uint16_t remotePort = 0;
+        bool fromProxyProtocol = false;
+
+        // when server started reading request, set by server for each request
+        std::chrono::steady_clock::time_point arrivalTime = std::chrono::steady_clock::now();
+
+        // sub-request of batch request, run in process
+        bool batched = false;
+    };
+} // namespace sd
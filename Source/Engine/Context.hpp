@@ -6,9 +6,12 @@
 #include "DI/ServiceProvider.hpp"
 #include "Data/DataContainer.hpp"
 #include "Engine/IContext.hpp"
+#include "Engine/RequestArena.hpp"
 #include "Engine/RoutingData.hpp"
+#include "Http/DefaultHeaders.hpp"
 #include "Http/Request.hpp"
 #include "Http/Response.hpp"
+#include "Services/IContextAccessor.hpp"
 #include <stdexcept>
 
 namespace sd
@@ -17,28 +20,63 @@ namespace sd
     class Context : public IContext
     {
       private:
+        RequestArena &_arena;
+        ServiceProvider &_rootServices;
+        IExecutor &_executor;
         Request _request;
         Response _response;
 
         IDataContainer::Ptr _dataContainer;
-        IRoutingData::Ptr _routingData;
+        ArenaPtr<RoutingData> _routingData;
+        IRoutingData::Ptr _customRoutingData;
         ClaimsPrincipal::Ptr _user;
-        ServiceProvider::Ptr _serviceProvider;
+        ArenaPtr<ServiceProvider> _serviceProvider;
+        Task<> _continuation;
 
       public:
-        Context(NativeRequest &native) : _request(native), _response(_request) {}
-
-        ServiceProvider &getRequestServices() { return utils::getRequired(_serviceProvider); }
-
-        void setServiceProvider(ServiceProvider::Ptr serviceProvider) { _serviceProvider = std::move(serviceProvider); }
+        Context(NativeRequest &native, const ConnectionInfo &connection, const DefaultHeaders &defaultHeaders,
+                RequestArena &arena, ServiceProvider &rootServices, IExecutor &executor)
+            : _arena(arena), _rootServices(rootServices), _executor(executor), _request(native, connection, arena),
+              _response(_request, defaultHeaders, arena)
+        {
+        }
+
+        // Request scope is created on first use, requests not touching scoped services skip it entirely
+        ServiceProvider &getRequestServices()
+        {
+            if (!_serviceProvider)
+            {
+                _serviceProvider = _arena.make<ServiceProvider>(_rootServices.makeScoped());
+                if (auto accessor = _serviceProvider->getService<IContextAccessor>())
+                {
+                    accessor->set(this);
+                }
+            }
+            return *_serviceProvider;
+        }
+
+        bool hasRequestServices() const { return _serviceProvider != nullptr; }
 
         const IRequest &getRequest() const { return _request; }
 
-        IResponse &getResponse() { return _response; }
+        IRequest &getRequest() { return _request; }
 
-        IRoutingData &getRoutingData() { return utils::getRequired(_routingData); }
+        IResponse &getResponse() { return _response; }
 
-        void setRoutingData(IRoutingData::Ptr routingData) { _routingData = std::move(routingData); }
+        IRoutingData &getRoutingData()
+        {
+            if (_customRoutingData)
+            {
+                return *_customRoutingData;
+            }
+            if (!_routingData)
+            {
+                _routingData = _arena.make<RoutingData>();
+            }
+            return *_routingData;
+        }
+
+        void setRoutingData(IRoutingData::Ptr routingData) { _customRoutingData = std::move(routingData); }
 
         IDataContainer &getData() { return utils::getRequired(_dataContainer); }
 
@@ -48,8 +86,27 @@ namespace sd
 
         void setUser(ClaimsPrincipal::Ptr user) { _user = std::move(user); }
 
-        NativeResponse getNativeResponse() { return _response.getNative(); }
+        bool isAuthenticated() const { return _user && _user->isAuthenticated(); }
+
+        void setContinuation(Task<> continuation)
+        {
+            _continuation = _continuation ? chain(std::move(_continuation), std::move(continuation))
+                                          : std::move(continuation);
+        }
+
+        Task<> takeContinuation() { return std::move(_continuation); }
+
+        IExecutor &getExecutor() { return _executor; }
+
+        NativeResponse takeNativeResponse() { return _response.takeNative(); }
 
         ~Context() = default;
+
+      private:
+        static Task<> chain(Task<> first, Task<> second)
+        {
+            co_await first;
+            co_await second;
+        }
     };
 } // namespace sd
\ No newline at end of file
@@ -1,12 +1,18 @@
 #pragma once
+#include <memory>
 #include <regex>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "Common/Utils.hpp"
 #include "Engine/Action.hpp"
+#include "Engine/IContext.hpp"
 #include "Engine/IEndpoint.hpp"
+#include "Engine/RequestCoalescer.hpp"
+#include "Http/Results.hpp"
 #include "Middlewares/IAuthorizer.hpp"
 
 namespace sd
@@ -15,34 +21,293 @@ namespace sd
     class Endpoint final : public IEndpoint
     {
       private:
+        using Plan = void (*)(const Endpoint &, IContext &);
+
         std::string _pathTemplate;
         HttpMethod _method;
         Action _action;
         std::vector<IAuthorizer::Ptr> _authorizers;
+        std::vector<PreTask> _preTasks;
+        std::vector<PostTask> _postTasks;
         RouteTemplateSegments _routeTemplateSegments;
+        std::unique_ptr<RequestCoalescer> _coalescer;
+        OutputCachePolicy::Ptr _outputCachePolicy;
+        RequestPriority _priority = RequestPriority::Normal;
+        Bulkhead::Ptr _bulkhead;
+        Plan _plan = &runFiltered;
+        Plan _guardedPlan = nullptr; // plan run inside bulkhead
+        bool _compiled = false;
 
       public:
         Endpoint(HttpMethod method, std::string_view path, Action action)
-            : _method(method), _pathTemplate(path), _action(std::move(action)), _routeTemplateSegments(_pathTemplate)
+            : _pathTemplate(path), _method(method), _action(std::move(action)), _routeTemplateSegments(_pathTemplate)
         {
         }
 
-        void addPreTask() {}
+        void addPreTask(PreTask task)
+        {
+            checkNotCompiled();
+            _preTasks.push_back(std::move(task));
+        }
 
-        void addAuthorization(IAuthorizer::Ptr authorizer) { _authorizers.push_back(std::move(authorizer)); }
+        void addAuthorization(IAuthorizer::Ptr authorizer)
+        {
+            checkNotCompiled();
+            _authorizers.push_back(std::move(authorizer));
+        }
 
         const RouteTemplateSegments &getRouteTemplateSegments() const { return _routeTemplateSegments; }
 
-        void addPostTask() {}
+        void addPostTask(PostTask task)
+        {
+            checkNotCompiled();
+            _postTasks.push_back(std::move(task));
+        }
+
+        // Key does not include body, so only safe methods can share response
+        void useCoalescing(CoalescingOptions options = {})
+        {
+            checkNotCompiled();
+            if (_method != HttpMethod::Get && _method != HttpMethod::Head)
+            {
+                throw std::runtime_error("Request coalescing can be used only with GET and HEAD endpoints");
+            }
+            _coalescer = std::make_unique<RequestCoalescer>(std::move(options));
+        }
+
+        void cacheOutput(OutputCachePolicy policy = {})
+        {
+            checkNotCompiled();
+            _outputCachePolicy = std::make_shared<const OutputCachePolicy>(std::move(policy));
+        }
+
+        const OutputCachePolicy::Ptr &getOutputCachePolicy() const { return _outputCachePolicy; }
+
+        void setPriority(RequestPriority priority)
+        {
+            checkNotCompiled();
+            _priority = priority;
+        }
+
+        RequestPriority getPriority() const { return _priority; }
+
+        using IEndpoint::useBulkhead;
+
+        void useBulkhead(Bulkhead::Ptr bulkhead)
+        {
+            checkNotCompiled();
+            _bulkhead = std::move(bulkhead);
+        }
 
         HttpMethod getHttpMethod() const { return _method; }
 
         std::string_view getRouteTemplate() const { return _pathTemplate; }
 
-        void executeAction(IContext &ctx) const { _action(ctx); }
+        // Endpoints without authorizers and tasks call action directly, plan is fixed from now on
+        void compile()
+        {
+            if (_outputCachePolicy && (!_authorizers.empty() || !_preTasks.empty()))
+            {
+                // cached responses are served before endpoint runs, they would skip authorization
+                throw std::runtime_error("Output cache can not be used on endpoint with authorizers or pre tasks: " +
+                                         _pathTemplate);
+            }
+            _compiled = true;
+            _authorizers.shrink_to_fit();
+            _preTasks.shrink_to_fit();
+            _postTasks.shrink_to_fit();
+            auto hasFilters = !_authorizers.empty() || !_preTasks.empty() || !_postTasks.empty();
+            _plan = _coalescer ? &runCoalesced : hasFilters ? &runFiltered : &runAction;
+            if (_bulkhead)
+            {
+                _guardedPlan = std::exchange(_plan, &runInBulkhead);
+            }
+        }
+
+        void executeAction(IContext &ctx) const { _plan(*this, ctx); }
 
         const std::vector<IAuthorizer::Ptr> &getAuthorization() const { return _authorizers; }
 
         ~Endpoint() = default;
+
+      private:
+        void checkNotCompiled() const
+        {
+            if (_compiled)
+            {
+                throw std::runtime_error("Endpoint can not be changed after application was started");
+            }
+        }
+
+        static void runAction(const Endpoint &endpoint, IContext &ctx) { endpoint._action(ctx); }
+
+        static void runFiltered(const Endpoint &endpoint, IContext &ctx)
+        {
+            if (runPreFilters(endpoint, ctx))
+            {
+                runActionAndPostTasks(endpoint, ctx);
+            }
+        }
+
+        // Authorization runs for every request, only action and post tasks are shared by coalesced requests
+        static void runCoalesced(const Endpoint &endpoint, IContext &ctx)
+        {
+            if (!runPreFilters(endpoint, ctx))
+            {
+                return;
+            }
+            if (!endpoint._coalescer->canJoin(ctx.getRequest()))
+            {
+                return runActionAndPostTasks(endpoint, ctx);
+            }
+            auto joined = endpoint._coalescer->join(ctx);
+            if (auto flight = std::get_if<RequestCoalescer::FlightPtr>(&joined))
+            {
+                return ctx.setContinuation(follow(endpoint, ctx, std::move(*flight)));
+            }
+            auto &lease = std::get<RequestCoalescer::Lease>(joined);
+            runActionAndPostTasks(endpoint, ctx);
+            if (auto continuation = ctx.takeContinuation())
+            {
+                return ctx.setContinuation(lead(endpoint, ctx, std::move(continuation), std::move(lease)));
+            }
+            publish(endpoint, ctx, lease);
+        }
+
+        // unpublished flight releases followers to run action on their own
+        static void publish(const Endpoint &endpoint, IContext &ctx, RequestCoalescer::Lease &lease)
+        {
+            auto &coalescer = *endpoint._coalescer;
+            lease.publish(coalescer.canPublish(ctx) ? ResponseSnapshot::capture(ctx.getResponse()) : nullptr);
+        }
+
+        static void runInBulkhead(const Endpoint &endpoint, IContext &ctx)
+        {
+            switch (endpoint._bulkhead->tryEnter())
+            {
+            case Bulkhead::Admission::Admitted:
+                return runWithSlot(endpoint, ctx, Bulkhead::Slot{*endpoint._bulkhead});
+            case Bulkhead::Admission::MustWait:
+                return ctx.setContinuation(runQueued(endpoint, ctx));
+            default:
+                return ServiceUnavailableResult{}.execute(ctx.getResponse());
+            }
+        }
+
+        static void runWithSlot(const Endpoint &endpoint, IContext &ctx, Bulkhead::Slot slot)
+        {
+            endpoint._guardedPlan(endpoint, ctx);
+            if (auto continuation = ctx.takeContinuation())
+            {
+                // slot is held until async part completes
+                ctx.setContinuation(holdDuring(std::move(continuation), std::move(slot)));
+            }
+        }
+
+        static Task<> runQueued(const Endpoint &endpoint, IContext &ctx)
+        {
+            if (!co_await endpoint._bulkhead->enter(ctx.getExecutor()))
+            {
+                ServiceUnavailableResult{}.execute(ctx.getResponse());
+                co_return;
+            }
+            Bulkhead::Slot slot{*endpoint._bulkhead};
+            endpoint._guardedPlan(endpoint, ctx);
+            if (auto continuation = ctx.takeContinuation())
+            {
+                co_await continuation;
+            }
+        }
+
+        static bool runPreFilters(const Endpoint &endpoint, IContext &ctx)
+        {
+            for (auto &authorizer : endpoint._authorizers)
+            {
+                if (auto result = authorizer->authorize(ctx); !result.isAuthorized)
+                {
+                    forbid(ctx, result);
+                    return false;
+                }
+            }
+            for (auto &task : endpoint._preTasks)
+            {
+                if (!task(ctx))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static void runActionAndPostTasks(const Endpoint &endpoint, IContext &ctx)
+        {
+            endpoint._action(ctx);
+            if (endpoint._postTasks.empty())
+            {
+                return;
+            }
+            if (auto continuation = ctx.takeContinuation())
+            {
+                // async action, post tasks run once it completes
+                return ctx.setContinuation(runPostTasksAfter(endpoint, ctx, std::move(continuation)));
+            }
+            runPostTasks(endpoint, ctx);
+        }
+
+        static Task<> lead(const Endpoint &endpoint, IContext &ctx, Task<> action, RequestCoalescer::Lease lease)
+        {
+            co_await action;
+            publish(endpoint, ctx, lease);
+        }
+
+        // leader failure or unshareable leader response leaves follower to run action on its own
+        static Task<> follow(const Endpoint &endpoint, IContext &ctx, RequestCoalescer::FlightPtr flight)
+        {
+            if (auto response = co_await flight->wait(ctx.getExecutor()))
+            {
+                response->apply(ctx.getResponse());
+                co_return;
+            }
+            runActionAndPostTasks(endpoint, ctx);
+            if (auto continuation = ctx.takeContinuation())
+            {
+                co_await continuation;
+            }
+        }
+
+        static void runPostTasks(const Endpoint &endpoint, IContext &ctx)
+        {
+            for (auto &task : endpoint._postTasks)
+            {
+                task(ctx);
+            }
+        }
+
+        static Task<> runPostTasksAfter(const Endpoint &endpoint, IContext &ctx, Task<> action)
+        {
+            co_await action;
+            runPostTasks(endpoint, ctx);
+        }
+
+        // Unauthenticated caller gets 401 with challenge so it knows how to authenticate, authenticated one gets 403
+        static void forbid(IContext &ctx, const AuthorizationResult &result)
+        {
+            if (!ctx.isAuthenticated())
+            {
+                reject<401>(ctx, result);
+                auto challenge = result.challenge.empty() ? std::string_view{"Bearer"} : result.challenge;
+                return ctx.getResponse().getHeaders().set("WWW-Authenticate", challenge);
+            }
+            reject<403>(ctx, result);
+        }
+
+        template <int StatusCode> static void reject(IContext &ctx, const AuthorizationResult &result)
+        {
+            if (result.reason.empty())
+            {
+                return StaticProblemResult<StatusCode>{}.execute(ctx.getResponse());
+            }
+            ProblemResult{StatusCode, getProblemTitle(StatusCode), result.reason}.execute(ctx.getResponse());
+        }
     };
-} // namespace sd
\ No newline at end of file
+} // namespace sd
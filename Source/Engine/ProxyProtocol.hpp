@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/asio/ip/address_v6.hpp>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Common/Utils.hpp"
+#include "Engine/ConnectionInfo.hpp"
+
+namespace sd
+{
+    // Parser of PROXY protocol v1 (text) and v2 (binary) headers
+    // https://www.haproxy.org/download/2.8/doc/proxy-protocol.txt
+    class ProxyProtocol
+    {
+      public:
+        enum class Status
+        {
+            Complete,
+            NeedMore,
+            Invalid
+        };
+
+        struct Result
+        {
+            Status status = Status::Invalid;
+            size_t headerSize = 0;
+        };
+
+        static constexpr size_t MaxV1Length = 107;
+        static constexpr size_t V2HeaderLength = 16;
+
+        // On success info is updated with source address unless the header is LOCAL/UNKNOWN (health checks)
+        static Result parse(std::string_view data, ConnectionInfo &info)
+        {
+            if (data.empty())
+            {
+                return {Status::NeedMore};
+            }
+            if (data.front() == V1Prefix.front())
+            {
+                return parseV1(data, info);
+            }
+            if (data.front() == V2Signature.front())
+            {
+                return parseV2(data, info);
+            }
+            return {Status::Invalid};
+        }
+
+      private:
+        static constexpr std::string_view V1Prefix = "PROXY ";
+        static constexpr std::string_view V2Signature{"\r\n\r\n\0\r\nQUIT\n", 12};
+
+        static bool isPrefix(std::string_view data, std::string_view pattern)
+        {
+            auto size = std::min(data.size(), pattern.size());
+            return data.substr(0, size) == pattern.substr(0, size);
+        }
+
+        static Result parseV1(std::string_view data, ConnectionInfo &info)
+        {
+            if (!isPrefix(data, V1Prefix))
+            {
+                return {Status::Invalid};
+            }
+            auto end = data.substr(0, MaxV1Length).find("\r\n");
+            if (end == std::string_view::npos)
+            {
+                return {data.size() < MaxV1Length ? Status::NeedMore : Status::Invalid};
+            }
+            Result result{Status::Complete, end + 2};
+
+            // PROXY <TCP4|TCP6|UNKNOWN> <src address> <dst address> <src port> <dst port>
+            auto parts = utils::split(data.substr(0, end), ' ');
+            if (parts.size() >= 2 && parts[1] == "UNKNOWN")
+            {
+                return result;
+            }
+            if (parts.size() != 6 || (parts[1] != "TCP4" && parts[1] != "TCP6"))
+            {
+                return {Status::Invalid};
+            }
+            auto v4 = parts[1] == "TCP4";
+            boost::asio::ip::address source, destination;
+            uint16_t port = 0, destinationPort = 0;
+            if (!parseV1Address(parts[2], v4, source) || !parseV1Address(parts[3], v4, destination) ||
+                !parseV1Port(parts[4], port) || !parseV1Port(parts[5], destinationPort))
+            {
+                return {Status::Invalid};
+            }
+            info.remoteAddress = source.to_string();
+            info.remotePort = port;
+            info.fromProxyProtocol = true;
+            return result;
+        }
+
+        static bool parseV1Address(std::string_view text, bool v4, boost::asio::ip::address &address)
+        {
+            boost::system::error_code ec;
+            address = boost::asio::ip::make_address(std::string{text}, ec);
+            return !ec && address.is_v4() == v4;
+        }
+
+        static bool parseV1Port(std::string_view text, uint16_t &port)
+        {
+            auto [ptr, err] = std::from_chars(text.data(), text.data() + text.size(), port);
+            return err == std::errc{} && ptr == text.data() + text.size();
+        }
+
+        static Result parseV2(std::string_view data, ConnectionInfo &info)
+        {
+            if (!isPrefix(data, V2Signature))
+            {
+                return {Status::Invalid};
+            }
+            if (data.size() < V2HeaderLength)
+            {
+                return {Status::NeedMore};
+            }
+            auto bytes = reinterpret_cast<const unsigned char *>(data.data());
+            auto version = bytes[12] >> 4;
+            auto command = bytes[12] & 0x0F;
+            auto family = bytes[13];
+            size_t length = (static_cast<size_t>(bytes[14]) << 8) | bytes[15];
+            if (version != 2 || command > 1)
+            {
+                return {Status::Invalid};
+            }
+            if (data.size() < V2HeaderLength + length)
+            {
+                return {Status::NeedMore};
+            }
+            Result result{Status::Complete, V2HeaderLength + length};
+            if (command == 0) // LOCAL
+            {
+                return result;
+            }
+            auto address = bytes + V2HeaderLength;
+            switch (family)
+            {
+            case 0x11: // TCP over IPv4
+            case 0x12: // UDP over IPv4
+                if (length < 12)
+                {
+                    return {Status::Invalid};
+                }
+                info.remoteAddress = boost::asio::ip::address_v4{readBytes<4>(address)}.to_string();
+                info.remotePort = readPort(address + 8);
+                break;
+            case 0x21: // TCP over IPv6
+            case 0x22: // UDP over IPv6
+                if (length < 36)
+                {
+                    return {Status::Invalid};
+                }
+                info.remoteAddress = boost::asio::ip::address_v6{readBytes<16>(address)}.to_string();
+                info.remotePort = readPort(address + 32);
+                break;
+            default: // UNSPEC and unix sockets carry no usable peer address
+                return result;
+            }
+            info.fromProxyProtocol = true;
+            return result;
+        }
+
+        template <size_t N> static std::array<unsigned char, N> readBytes(const unsigned char *data)
+        {
+            std::array<unsigned char, N> result;
+            std::copy(data, data + N, result.begin());
+            return result;
+        }
+
+        static uint16_t readPort(const unsigned char *data) { return static_cast<uint16_t>((data[0] << 8) | data[1]); }
+    };
+} // namespace sd
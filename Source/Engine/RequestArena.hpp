@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <utility>
+
+#include "Common/ArenaStatistics.hpp"
+
+namespace sd
+{
+    // Arena memory is released all at once, deleter only runs destructor
+    template <class T> struct ArenaDeleter
+    {
+        void operator()(T *ptr) const { std::destroy_at(ptr); }
+    };
+
+    template <class T> using ArenaPtr = std::unique_ptr<T, ArenaDeleter<T>>;
+
+    class ArenaStatisticsCollector
+    {
+      private:
+        std::atomic<uint64_t> _requests = 0;
+        std::atomic<uint64_t> _allocatedBytes = 0;
+        std::atomic<uint64_t> _maxRequestBytes = 0;
+        std::atomic<uint64_t> _overflows = 0;
+
+      public:
+        void record(size_t bytes, bool overflow)
+        {
+            _requests.fetch_add(1, std::memory_order_relaxed);
+            _allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+            if (overflow)
+            {
+                _overflows.fetch_add(1, std::memory_order_relaxed);
+            }
+            auto max = _maxRequestBytes.load(std::memory_order_relaxed);
+            while (max < bytes && !_maxRequestBytes.compare_exchange_weak(max, bytes, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        ArenaStatistics get() const
+        {
+            return {_requests.load(std::memory_order_relaxed), _allocatedBytes.load(std::memory_order_relaxed),
+                    _maxRequestBytes.load(std::memory_order_relaxed), _overflows.load(std::memory_order_relaxed)};
+        }
+    };
+
+    // Monotonic arena for objects living as long as one request. Memory comes from a buffer recycled per thread,
+    // when a request does not fit the buffer grows so next requests on this thread do not touch the heap. Arena owns
+    // its buffer while alive, so request suspended on one thread can finish on another
+    class RequestArena final : public std::pmr::memory_resource
+    {
+      public:
+        static constexpr size_t InitialBufferSize = 4 * 1024;
+        static constexpr size_t MaxBufferSize = 64 * 1024;
+
+      private:
+        struct Buffer
+        {
+            std::unique_ptr<std::byte[]> data;
+            size_t size = 0;
+        };
+
+        // Heap used by monotonic resource once buffer is exhausted, alignment padding can exhaust it even when
+        // requested bytes fit
+        class Upstream final : public std::pmr::memory_resource
+        {
+          public:
+            size_t allocated = 0;
+
+          private:
+            void *do_allocate(size_t bytes, size_t alignment) final
+            {
+                allocated += bytes;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void *ptr, size_t bytes, size_t alignment) final
+            {
+                std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource &other) const noexcept final { return this == &other; }
+        };
+
+        ArenaStatisticsCollector *_statistics;
+        Buffer _buffer;
+        Upstream _upstream;
+        std::optional<std::pmr::monotonic_buffer_resource> _resource;
+        size_t _allocated = 0;
+
+      public:
+        explicit RequestArena(ArenaStatisticsCollector *statistics = nullptr)
+            : _statistics(statistics), _buffer(std::exchange(getThreadBuffer(), {}))
+        {
+            // thread buffer is empty for first and nested arenas on the same thread
+            if (!_buffer.data)
+            {
+                _buffer = {std::make_unique<std::byte[]>(InitialBufferSize), InitialBufferSize};
+            }
+            _resource.emplace(_buffer.data.get(), _buffer.size, &_upstream);
+        }
+
+        RequestArena(const RequestArena &) = delete;
+        RequestArena &operator=(const RequestArena &) = delete;
+
+        template <class T, class... Args> ArenaPtr<T> make(Args &&...args)
+        {
+            auto memory = allocate(sizeof(T), alignof(T));
+            return ArenaPtr<T>{new (memory) T(std::forward<Args>(args)...)};
+        }
+
+        size_t getAllocatedBytes() const { return _allocated; }
+
+        ~RequestArena()
+        {
+            _resource.reset();
+            bool overflow = _upstream.allocated > 0;
+            if (overflow && _buffer.size < MaxBufferSize)
+            {
+                // at least doubled, request may have overflowed only because of padding
+                _buffer.size = std::min(MaxBufferSize, std::bit_ceil(std::max(_allocated, _buffer.size + 1)));
+                _buffer.data = std::make_unique<std::byte[]>(_buffer.size);
+            }
+            if (auto &threadBuffer = getThreadBuffer(); threadBuffer.size < _buffer.size)
+            {
+                threadBuffer = std::move(_buffer);
+            }
+            if (_statistics)
+            {
+                _statistics->record(_allocated, overflow);
+            }
+        }
+
+      private:
+        static Buffer &getThreadBuffer()
+        {
+            thread_local Buffer buffer;
+            return buffer;
+        }
+
+        void *do_allocate(size_t bytes, size_t alignment) final
+        {
+            _allocated += bytes;
+            return _resource->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *, size_t, size_t) final {}
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept final { return this == &other; }
+    };
+} // namespace sd
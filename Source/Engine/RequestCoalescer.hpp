@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <coroutine>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "Common/ShardedMap.hpp"
+#include "Common/Utils.hpp"
+#include "Engine/CoalescingOptions.hpp"
+#include "Engine/IContext.hpp"
+#include "Http/IRequest.hpp"
+#include "Http/ResponseSnapshot.hpp"
+
+namespace sd
+{
+    // Single-flight execution of identical concurrent requests: first request leads and runs the endpoint, requests
+    // arriving while it runs await its response instead. Requests with Authorization or Cookie header are coalesced
+    // only when options vary by that header, responses setting cookies or made for authenticated users are not shared
+    class RequestCoalescer
+    {
+      public:
+        // Awaiting flight yields leader response, or null when leader failed
+        class Flight
+        {
+          private:
+            struct Waiter
+            {
+                std::coroutine_handle<> handle;
+                IExecutor &executor;
+            };
+
+            std::mutex _mutex;
+            bool _done = false;
+            ResponseSnapshot::Ptr _response;
+            std::vector<Waiter> _waiters;
+
+            struct Awaiter
+            {
+                Flight &flight;
+                IExecutor &executor;
+
+                bool await_ready()
+                {
+                    std::lock_guard lock{flight._mutex};
+                    return flight._done;
+                }
+
+                bool await_suspend(std::coroutine_handle<> waiter)
+                {
+                    std::lock_guard lock{flight._mutex};
+                    if (flight._done)
+                    {
+                        return false;
+                    }
+                    flight._waiters.push_back({waiter, executor});
+                    return true;
+                }
+
+                ResponseSnapshot::Ptr await_resume() { return flight._response; }
+            };
+
+          public:
+            // Followers are resumed through executor, so leader does not run all of them on its own thread
+            Awaiter wait(IExecutor &executor) { return {*this, executor}; }
+
+            void finish(ResponseSnapshot::Ptr response)
+            {
+                std::vector<Waiter> waiters;
+                {
+                    std::lock_guard lock{_mutex};
+                    _response = std::move(response);
+                    _done = true;
+                    waiters.swap(_waiters);
+                }
+                for (auto &waiter : waiters)
+                {
+                    waiter.executor.post(waiter.handle);
+                }
+            }
+        };
+
+        using FlightPtr = std::shared_ptr<Flight>;
+
+        // Held by leader, flight that was not published (leader failed) releases followers with null response
+        class Lease
+        {
+          private:
+            RequestCoalescer *_coalescer;
+            std::string _key;
+            FlightPtr _flight;
+
+          public:
+            Lease(RequestCoalescer &coalescer, std::string key, FlightPtr flight)
+                : _coalescer(&coalescer), _key(std::move(key)), _flight(std::move(flight))
+            {
+            }
+
+            Lease(Lease &&other) noexcept = default;
+            Lease &operator=(Lease &&other) = delete;
+
+            void publish(ResponseSnapshot::Ptr response)
+            {
+                if (auto flight = std::exchange(_flight, nullptr))
+                {
+                    _coalescer->land(_key, *flight, std::move(response));
+                }
+            }
+
+            ~Lease() { publish(nullptr); }
+        };
+
+      private:
+        CoalescingOptions _options;
+        utils::ShardedMap<std::string, FlightPtr> _flights;
+
+      public:
+        explicit RequestCoalescer(CoalescingOptions options) : _options(std::move(options)) {}
+
+        // Lease when caller leads new flight, otherwise flight to await
+        std::variant<Lease, FlightPtr> join(const IContext &ctx)
+        {
+            auto key = makeKey(ctx.getRequest());
+            FlightPtr flight;
+            bool leader = false;
+            _flights.apply(key, [&](auto &flights) {
+                auto &slot = flights[key];
+                if (!slot)
+                {
+                    slot = std::make_shared<Flight>();
+                    leader = true;
+                }
+                flight = slot;
+            });
+            if (leader)
+            {
+                return Lease{*this, std::move(key), std::move(flight)};
+            }
+            return flight;
+        }
+
+        // Credentials make response specific to caller, such request can not join flight of other caller
+        bool canJoin(const IRequest &request) const
+        {
+            auto &headers = request.getHeaders();
+            return (!headers.has("Authorization") || variesBy("Authorization")) &&
+                   (!headers.has("Cookie") || variesBy("Cookie"));
+        }
+
+        // User is known only after authorization ran, response for authenticated user is shared only when request key
+        // contains its credentials
+        bool canPublish(IContext &ctx) const
+        {
+            if (ctx.getResponse().getHeaders().has("Set-Cookie"))
+            {
+                return false;
+            }
+            return !ctx.isAuthenticated() || isKeyedByCaller(ctx.getRequest());
+        }
+
+        size_t getInFlightCount() { return _flights.size(); }
+
+      private:
+        bool isKeyedByCaller(const IRequest &request) const
+        {
+            auto &headers = request.getHeaders();
+            return (headers.has("Authorization") && variesBy("Authorization")) ||
+                   (headers.has("Cookie") && variesBy("Cookie"));
+        }
+
+        bool variesBy(std::string_view header) const
+        {
+            return std::any_of(_options.varyByHeaders.begin(), _options.varyByHeaders.end(),
+                               [&](const std::string &name) { return utils::iequals(name, header); });
+        }
+
+        std::string makeKey(const IRequest &request) const
+        {
+            auto query = request.getQueryString();
+            std::string key{std::to_string(request.getMethod())};
+            key += ' ';
+            key += request.getPath();
+            if (!query.empty())
+            {
+                key += '?';
+                key += query;
+            }
+            auto &headers = request.getHeaders();
+            for (auto &name : _options.varyByHeaders)
+            {
+                key += '\n';
+                key += headers.get(name).value_or("");
+            }
+            return key;
+        }
+
+        // flight is removed first so requests arriving after it finished start new one
+        void land(const std::string &key, Flight &flight, ResponseSnapshot::Ptr response)
+        {
+            _flights.apply(key, [&](auto &flights) {
+                if (auto it = flights.find(key); it != flights.end() && it->second.get() == &flight)
+                {
+                    flights.erase(it);
+                }
+            });
+            flight.finish(std::move(response));
+        }
+    };
+} // namespace sd
@@ -1,76 +1,107 @@
 #pragma once
 
-#include <memory>
+#include <optional>
 #include <stdexcept>
-#include <variant>
+#include <string>
+#include <string_view>
 
-#include "BoostBeastServer.hpp"
-#include "DI/ServiceProvider.hpp"
-#include "Engine/IContext.hpp"
+#include "Engine/IEndpoint.hpp"
 #include "Engine/IRoutingData.hpp"
-#include "Http/Request.hpp"
-#include "Http/Response.hpp"
-#include "Http/RouteParams.hpp"
+#include "Http/IRouteParamsView.hpp"
+#include "Router/RouteMatch.hpp"
 
 namespace sd
 {
-
-    class RoutingData final : public IRoutingData
+    // Route params read from offsets captured by router, names come from endpoint route template
+    class RouteValuesView final : public IRouteParamsView
     {
       private:
-        Request &_request;
-
-        const IEndpoint *_endpoint = nullptr;
-
-        mutable RouteParams::Ptr _routeParams;
+        const std::string &_path;
+        const RouteMatch &_match;
 
       public:
-        RoutingData(Request &native) : _request(native) {}
-
-        const IEndpoint *getEndpoint() const { return _endpoint; }
+        RouteValuesView(const std::string &path, const RouteMatch &match) : _path(path), _match(match) {}
 
-        void setEndpoint(const IEndpoint *endpoint) { _endpoint = endpoint; }
+        std::optional<std::string_view> get(std::string_view key) const
+        {
+            if (auto index = findIndex(key))
+            {
+                return _match.getValue(_path, *index);
+            }
+            return std::nullopt;
+        }
 
-        const IRouteParamsView &getRouteParams() const
+        std::string_view getRequired(std::string_view key) const
         {
-            if (!_routeParams)
+            if (auto value = get(key))
             {
-                _routeParams = createRouteParams(_request.getPath());
+                return *value;
             }
-            return *_routeParams;
+            throw std::runtime_error("not found param");
         }
 
-        ~RoutingData() = default;
+        bool has(std::string_view key) const { return findIndex(key).has_value(); }
 
-      private:
-        RouteParams::Ptr createRouteParams(std::string_view path) const
+        size_t size() const { return _match.size(); }
+
+        bool empty() const { return _match.size() == 0; }
+
+        void forEach(Accesor func) const
         {
-            auto params = std::make_unique<RouteParams>();
-            if (!_endpoint)
+            if (!_match)
             {
-                return params;
+                return;
             }
-            auto &endpointSegments = _endpoint->getRouteTemplateSegments();
-            auto segmentsStr = utils::split(path);
-            if (segmentsStr.empty())
+            auto &names = _match->getRouteTemplateSegments().getParamNames();
+            for (size_t i = 0; i < _match.size(); ++i)
             {
-                // todo throw
+                if (func(names[i], _match.getValue(_path, i)) == Enumeration::Stop)
+                {
+                    break;
+                }
             }
-            segmentsStr.erase(segmentsStr.begin());
-            if (endpointSegments.size() != segmentsStr.size())
+        }
+
+      private:
+        std::optional<size_t> findIndex(std::string_view key) const
+        {
+            if (!_match)
             {
-                return params;
+                return std::nullopt;
             }
-            for (int i = 0; i < endpointSegments.size(); ++i)
+            auto index = _match->getRouteTemplateSegments().findParamIndex(key);
+            if (index && *index < _match.size())
             {
-                auto &templateSegment = endpointSegments.at(i);
-                auto &segment = segmentsStr.at(i);
-                if (auto routeParam = std::get_if<RouteParam>(&templateSegment))
-                {
-                    params->add(routeParam->name, segment);
-                }
+                return index;
             }
-            return params;
+            return std::nullopt;
+        }
+    };
+
+    class RoutingData final : public IRoutingData
+    {
+      private:
+        std::string _path;
+        RouteMatch _match;
+        RouteValuesView _routeParams{_path, _match};
+
+      public:
+        RoutingData() = default;
+        RoutingData(const RoutingData &) = delete;
+        RoutingData &operator=(const RoutingData &) = delete;
+
+        const IEndpoint *getEndpoint() const { return _match.getEndpoint(); }
+
+        void setEndpoint(const IEndpoint *endpoint) { _match = RouteMatch{endpoint}; }
+
+        void setMatch(std::string path, const RouteMatch &match)
+        {
+            _path = std::move(path);
+            _match = match;
         }
+
+        const IRouteParamsView &getRouteParams() const { return _routeParams; }
+
+        ~RoutingData() = default;
     };
-} // namespace sd
\ No newline at end of file
+} // namespace sd
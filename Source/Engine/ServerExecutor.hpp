@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <coroutine>
+
+#include "Common/IExecutor.hpp"
+#include "Common/InlineExecutor.hpp"
+
+namespace sd
+{
+    // Resumes coroutines on server threads, on calling thread when server is not running (test requests)
+    class ServerExecutor final : public IExecutor
+    {
+      private:
+        std::atomic<boost::asio::io_context *> _context{nullptr};
+        InlineExecutor _inline;
+
+      public:
+        void attach(boost::asio::io_context &context) { _context = &context; }
+
+        void detach() { _context = nullptr; }
+
+        void post(std::coroutine_handle<> handle)
+        {
+            if (auto context = _context.load())
+            {
+                return boost::asio::post(*context, [handle] { handle.resume(); });
+            }
+            _inline.post(handle);
+        }
+
+        bool postsInline() const { return !_context.load(); }
+
+        bool runningInThisThread() const
+        {
+            auto context = _context.load();
+            return !context || context->get_executor().running_in_this_thread();
+        }
+    };
+} // namespace sd
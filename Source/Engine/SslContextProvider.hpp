@@ -0,0 +1,233 @@
+#pragma once
+
+#include <atomic>
+#include <boost/asio/ssl/context.hpp>
+#include <cctype>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <openssl/ssl.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/ServerSettings.hpp"
+#include "Common/Utils.hpp"
+#include "Engine/CertLoader.hpp"
+
+namespace sd
+{
+    // Contexts for all configured certificates, handshake starts on the default one and is switched to the one
+    // matching SNI host name (exact match first, then "*.domain" wildcard). One set is shared by all listeners of
+    // server, certificates are not selected per listener
+    class SslContextSet
+    {
+      public:
+        using Ptr = std::shared_ptr<const SslContextSet>;
+        using ContextPtr = std::shared_ptr<boost::asio::ssl::context>;
+
+      private:
+        // case insensitive, so host names from handshakes are looked up without copying them
+        struct HostHash
+        {
+            using is_transparent = void;
+
+            size_t operator()(std::string_view host) const
+            {
+                size_t hash = 14695981039346656037ull;
+                for (unsigned char c : host)
+                {
+                    hash = (hash ^ std::tolower(c)) * 1099511628211ull;
+                }
+                return hash;
+            }
+        };
+
+        struct HostEqual
+        {
+            using is_transparent = void;
+
+            bool operator()(std::string_view left, std::string_view right) const { return utils::iequals(left, right); }
+        };
+
+        using Hosts = std::unordered_map<std::string, boost::asio::ssl::context *, HostHash, HostEqual>;
+
+        ContextPtr _default;
+        std::vector<ContextPtr> _contexts;
+        Hosts _hosts;
+        Hosts _wildcards; // "*.example.com" stored as ".example.com"
+
+      public:
+        SslContextSet(const ServerSettings &settings)
+        {
+            if (!settings.certificateFile.empty())
+            {
+                _default = createContext(settings.certificateFile, settings.privateKeyFile);
+            }
+            for (auto &certificate : settings.certificates)
+            {
+                auto &context = _contexts.emplace_back(
+                    createContext(certificate.certificateFile, certificate.privateKeyFile));
+                for (auto &host : certificate.hosts)
+                {
+                    if (host.starts_with("*."))
+                    {
+                        _wildcards.try_emplace(host.substr(1), context.get());
+                    }
+                    else
+                    {
+                        _hosts.try_emplace(host, context.get());
+                    }
+                }
+            }
+            if (!_default)
+            {
+                _default = _contexts.empty() ? createContext() : _contexts.front();
+            }
+            if (!_hosts.empty() || !_wildcards.empty())
+            {
+                SSL_CTX_set_tlsext_servername_callback(_default->native_handle(), &SslContextSet::onServerName);
+                SSL_CTX_set_tlsext_servername_arg(_default->native_handle(), this);
+            }
+        }
+
+        SslContextSet(const SslContextSet &) = delete;
+        SslContextSet &operator=(const SslContextSet &) = delete;
+
+        boost::asio::ssl::context &getDefault() const { return *_default; }
+
+        boost::asio::ssl::context *find(std::string_view hostName) const
+        {
+            if (auto it = _hosts.find(hostName); it != _hosts.end())
+            {
+                return it->second;
+            }
+            if (auto dot = hostName.find('.'); dot != std::string_view::npos)
+            {
+                if (auto it = _wildcards.find(hostName.substr(dot)); it != _wildcards.end())
+                {
+                    return it->second;
+                }
+            }
+            return nullptr;
+        }
+
+      private:
+        static int onServerName(SSL *ssl, int *, void *arg)
+        {
+            auto set = static_cast<const SslContextSet *>(arg);
+            if (auto name = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name))
+            {
+                if (auto context = set->find(name); context && context != set->_default.get())
+                {
+                    SSL_set_SSL_CTX(ssl, context->native_handle());
+                }
+            }
+            return SSL_TLSEXT_ERR_OK;
+        }
+
+        static ContextPtr createContext(const std::string &certificateFile = {}, const std::string &privateKeyFile = {})
+        {
+            auto context = std::make_shared<boost::asio::ssl::context>(boost::asio::ssl::context::tlsv12);
+            if (certificateFile.empty())
+            {
+                CertLoader::load(*context);
+            }
+            else
+            {
+                CertLoader::loadFromFiles(*context, certificateFile, privateKeyFile);
+            }
+            return context;
+        }
+    };
+
+    // Owns current certificates, new handshakes take the latest set while established sessions keep the set they
+    // were created with alive through shared ownership. Handshakes read the set without locking, sets are built under
+    // mutex so concurrent reloads can not store an older set last
+    class SslContextProvider
+    {
+      private:
+        using FilesVersion = std::vector<std::filesystem::file_time_type>;
+
+        const ServerSettings &_settings;
+
+        // accessed with std::atomic_load/atomic_store, std::atomic<std::shared_ptr> is missing in libc++
+        SslContextSet::Ptr _contexts;
+        std::mutex _mutex;
+        FilesVersion _version; // of files current set was loaded from, guarded by mutex
+
+      public:
+        SslContextProvider(const ServerSettings &settings) : _settings(settings) {}
+
+        bool usesFiles() const { return !_settings.certificateFile.empty() || !_settings.certificates.empty(); }
+
+        SslContextSet::Ptr get()
+        {
+            if (auto contexts = std::atomic_load_explicit(&_contexts, std::memory_order_acquire))
+            {
+                return contexts;
+            }
+            std::lock_guard lock{_mutex};
+            if (auto contexts = std::atomic_load_explicit(&_contexts, std::memory_order_acquire))
+            {
+                return contexts;
+            }
+            return load(readVersion());
+        }
+
+        // Loads certificates and keys again, on failure exception is thrown and current set stays in use
+        void reload()
+        {
+            std::lock_guard lock{_mutex};
+            load(readVersion());
+        }
+
+        // Returns true if files were modified and new set was loaded
+        bool reloadIfChanged()
+        {
+            if (!usesFiles())
+            {
+                return false;
+            }
+            std::lock_guard lock{_mutex};
+            auto version = readVersion();
+            if (std::atomic_load_explicit(&_contexts, std::memory_order_acquire) && _version == version)
+            {
+                return false;
+            }
+            load(std::move(version));
+            return true;
+        }
+
+      private:
+        // called with mutex held
+        SslContextSet::Ptr load(FilesVersion version)
+        {
+            auto contexts = std::make_shared<const SslContextSet>(_settings);
+            _version = std::move(version);
+            std::atomic_store_explicit(&_contexts, contexts, std::memory_order_release);
+            return contexts;
+        }
+
+        FilesVersion readVersion() const
+        {
+            FilesVersion version;
+            auto add = [&](const std::string &file) {
+                std::error_code ec;
+                version.push_back(std::filesystem::last_write_time(file, ec));
+            };
+            if (!_settings.certificateFile.empty())
+            {
+                add(_settings.certificateFile);
+                add(_settings.privateKeyFile);
+            }
+            for (auto &certificate : _settings.certificates)
+            {
+                add(certificate.certificateFile);
+                add(certificate.privateKeyFile);
+            }
+            return version;
+        }
+    };
+} // namespace sd
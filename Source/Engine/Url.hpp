@@ -4,6 +4,8 @@
 #include <boost/container_hash/hash.hpp>
 #include <string>
 
+#include "Common/Utils.hpp"
+
 namespace sd
 {
     struct Url
@@ -11,6 +13,8 @@ namespace sd
         std::string host = "localhost";
         uint16_t port = 9090;
         bool useSsl = false;
+        // listener expects PROXY protocol v1/v2 header before each connection, enabled by "?proxyProtocol=true"
+        bool useProxyProtocol = false;
 
         Url(std::string url)
         {
@@ -25,6 +29,14 @@ namespace sd
                 port = urlView.port_number();
             }
             host = urlView.host();
+            std::string query = urlView.query();
+            for (auto param : utils::split(query, '&'))
+            {
+                if (param == "proxyProtocol=true" || param == "proxyProtocol=1")
+                {
+                    useProxyProtocol = true;
+                }
+            }
         }
 
         std::string toString()
@@ -33,13 +45,18 @@ namespace sd
             urlView.set_scheme_id(useSsl ? boost::urls::scheme::https : boost::urls::scheme::http);
             urlView.set_port_number(port);
             urlView.set_host(host);
+            if (useProxyProtocol)
+            {
+                urlView.set_query("proxyProtocol=true");
+            }
             return std::string{urlView.buffer()};
         }
     };
 
     inline bool operator==(const Url &l, const Url &r)
     {
-        return l.useSsl == r.useSsl && l.host == r.host && l.port == r.port;
+        return l.useSsl == r.useSsl && l.host == r.host && l.port == r.port &&
+               l.useProxyProtocol == r.useProxyProtocol;
     }
 } // namespace sd
 
@@ -51,6 +68,7 @@ template <> struct std::hash<sd::Url>
         boost::hash_combine(result, url.host);
         boost::hash_combine(result, url.port);
         boost::hash_combine(result, url.useSsl);
+        boost::hash_combine(result, url.useProxyProtocol);
         return result;
     }
 };
\ No newline at end of file
@@ -1,9 +1,10 @@
 #pragma once
 
-#include <_types/_uint16_t.h>
 #include <boost/url/url.hpp>
-#include <experimental/coroutine>
+#include <condition_variable>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -13,21 +14,29 @@
 #include <vector>
 
 #include "Common/LibraryConfig.hpp"
+#include "Common/Task.hpp"
 #include "Configuration/IConfiguration.hpp"
 #include "DI/IServiceHolder.hpp"
 #include "DI/ServiceOwner.hpp"
 #include "DI/ServiceProvider.hpp"
+#include "Engine/BatchHandler.hpp"
 #include "Engine/BoostBeastServer.hpp"
 #include "Engine/CancellationSignals.hpp"
 #include "Engine/Context.hpp"
 #include "Engine/Endpoint.hpp"
 #include "Engine/IContext.hpp"
 #include "Engine/IWebApplicationEngine.hpp"
+#include "Http/DefaultHeaders.hpp"
+#include "Http/HeaderBlock.hpp"
 #include "Http/HttpMethod.hpp"
 #include "Http/IResult.hpp"
+#include "Http/Results.hpp"
+#include "Http/TestRequest.hpp"
+#include "Http/TestResponse.hpp"
 #include "Log/ILogger.hpp"
 #include "Log/LogMarkers.hpp"
 #include "Middlewares/MiddlewareCreators.hpp"
+#include "Middlewares/MiddlewarePipeline.hpp"
 #include "Middlewares/MiddlewaresRunner.hpp"
 #include "Middlewares/RouterMiddleware.hpp"
 #include "Router/Router.hpp"
@@ -43,6 +52,11 @@ namespace sd
 
         ILogger::Ptr _logger;
         MiddlewareCreators _middlewareCreators;
+        MiddlewarePipeline _pipeline;
+        ArenaStatisticsCollector _arenaStatistics;
+        DefaultHeaders _defaultHeaders;
+        std::vector<std::unique_ptr<BatchHandler>> _batchHandlers;
+        std::once_flag _initialized;
 
         BoostBeastServer _server;
 
@@ -50,7 +64,7 @@ namespace sd
         WebApplicationEngine(EngineDependencies::Ptr dependencies)
             : _dependencies(moveAndCheck(std::move(dependencies))),
               _logger(_dependencies->getLogger().createFor<WebApplicationEngine>()),
-              _server(getThisLogger(), createHandler(), getServerSettings())
+              _defaultHeaders(getServerSettings()), _server(getThisLogger(), createHandler(), getServerSettings())
         {
         }
 
@@ -63,11 +77,15 @@ namespace sd
             return dependencies;
         }
 
+        // Safe to call several times, application handling test requests can be run later
         void init() final
         {
-            getRouter().compile();
-            getServiceProvider().prebuildSingeletons();
-            checkMiddlewares();
+            std::call_once(_initialized, [this] {
+                getRouter().compile();
+                getServiceProvider().prebuildSingeletons();
+                checkMiddlewares();
+                _pipeline.build(_middlewareCreators);
+            });
         }
 
         void run(std::optional<std::string> url, int threadsNumber) final
@@ -85,15 +103,75 @@ namespace sd
 
         void stop() final { _server.stop(); }
 
+        void reloadCertificates() final { _server.reloadCertificates(); }
+
+        TestResponse handle(const TestRequest &request) final
+        {
+            auto native = createNativeRequest(request);
+            auto res = handle(native, {.remoteAddress = request.remoteAddress,
+                                       .remotePort = request.remotePort,
+                                       .arrivalTime = request.arrivalTime});
+
+            TestResponse response{static_cast<int>(res.result_int())};
+            for (auto &field : res.base())
+            {
+                response.headers.push_back({std::string{field.name_string()}, std::string{field.value()}});
+            }
+            response.body = res.body().toString();
+            return response;
+        }
+
+        // Runs request through the pipeline without server, blocks if response is completed on other thread
+        NativeResponse handle(NativeRequest &req, const ConnectionInfo &info)
+        {
+            struct Completion
+            {
+                std::mutex mutex;
+                std::condition_variable signal;
+                std::optional<NativeResponse> response;
+                std::exception_ptr exception;
+                bool done = false;
+            } completion;
+
+            startTask(createRequestTask(req, info), [&completion](std::exception_ptr exception,
+                                                                   std::optional<NativeResponse> response) {
+                std::lock_guard lock{completion.mutex};
+                completion.exception = exception;
+                completion.response = std::move(response);
+                completion.done = true;
+                completion.signal.notify_one();
+            });
+            std::unique_lock lock{completion.mutex};
+            completion.signal.wait(lock, [&completion] { return completion.done; });
+            if (completion.exception)
+            {
+                std::rethrow_exception(completion.exception);
+            }
+            return std::move(*completion.response);
+        }
+
         IEndpoint *map(HttpMethod method, std::string_view path, Action action) final
         {
             return addEndpoint(method, path, std::move(action));
         }
 
+        IEndpoint *mapBatch(std::string_view path, BatchOptions options) final
+        {
+            auto parallel = options.parallel;
+            auto &handler = _batchHandlers.emplace_back(std::make_unique<BatchHandler>(
+                options, [this, parallel](NativeRequest &req, const ConnectionInfo &info) {
+                    return createSubRequestTask(req, info, parallel);
+                }));
+            return addEndpoint(HttpMethod::Post, path,
+                               [batch = handler.get()](IContext &ctx) { ctx.setContinuation(batch->handle(ctx)); });
+        }
+
         void use(IMiddlewareCreator::Ptr creator) final { _middlewareCreators.add(std::move(creator)); }
 
         void useAsFirst(IMiddlewareCreator::Ptr creator) final { _middlewareCreators.addFront(std::move(creator)); }
 
+        void useHeaders(HeaderBlock::Ptr headers) final { _defaultHeaders.add(std::move(headers)); }
+
         void useRouter() final { use(std::make_unique<RouterMiddlewareCreator>(&getRouter())); }
 
         void useEndpoints() final { use(std::make_unique<EndpointsMiddlewareCreator>()); }
@@ -106,48 +184,108 @@ namespace sd
 
         ServiceProvider &getServiceProvider() final { return _dependencies->getServiceProvider(); }
 
+        IRouter &getRouter() final { return _dependencies->getRouter(); }
+
+        ArenaStatistics getArenaStatistics() const final { return _arenaStatistics.get(); }
+
         ~WebApplicationEngine() {}
 
       private:
         ServerRequestHandler createHandler()
         {
-            return [this](NativeRequest &req) { return handleRequest(req); };
+            return [this](NativeRequest &req, const ConnectionInfo &info) { return createRequestTask(req, info); };
+        }
+
+        // Request code continues on server threads even when it awaits work completed on other threads
+        Task<NativeResponse> createRequestTask(NativeRequest &req, const ConnectionInfo &info)
+        {
+            auto task = handleRequest(req, info);
+            task.setExecutor(_server.getExecutor());
+            return task;
+        }
+
+        // Parallel sub-requests are started as root tasks, like requests from server they continue on server threads
+        Task<NativeResponse> createSubRequestTask(NativeRequest &req, const ConnectionInfo &info, bool parallel)
+        {
+            auto task = handleSubRequest(req, info, parallel);
+            task.setExecutor(_server.getExecutor());
+            return task;
         }
 
         ILogger &getThisLogger() { return *_logger; }
 
         ServerSettings getServerSettings() { return _dependencies->getSettingsProvider().getSettings(); }
 
-        IRouter &getRouter() { return _dependencies->getRouter(); }
-
         IEndpoint *addEndpoint(HttpMethod method, std::string_view path, Action action)
         {
             auto endpoint = std::unique_ptr<Endpoint>(new Endpoint(method, path, std::move(action)));
             return getRouter().addEndpoint(std::move(endpoint));
         }
 
+        static NativeRequest createNativeRequest(const TestRequest &request)
+        {
+            NativeRequest native{toVerb(request.method), request.target, 11};
+            for (auto &header : request.headers)
+            {
+                native.insert(header.name, header.value);
+            }
+            if (!request.body.empty())
+            {
+                native.body() = request.body;
+                native.prepare_payload();
+            }
+            return native;
+        }
+
+        static boost::beast::http::verb toVerb(HttpMethod method)
+        {
+            using verb = boost::beast::http::verb;
+            switch (method)
+            {
+            case HttpMethod::Get:
+                return verb::get;
+            case HttpMethod::Put:
+                return verb::put;
+            case HttpMethod::Post:
+                return verb::post;
+            case HttpMethod::Patch:
+                return verb::patch;
+            case HttpMethod::Delete:
+                return verb::delete_;
+            case HttpMethod::Head:
+                return verb::head;
+            default:
+                throw std::runtime_error("Unsupported test request method");
+            }
+        }
+
         void checkMiddlewares()
         {
-            if (!_middlewareCreators.has<RouterMiddlewareCreator>())
+            if (!_middlewareCreators.provides<RouterMiddleware>())
             {
                 useAsFirst(std::make_unique<RouterMiddlewareCreator>(&getRouter()));
             }
-            if (!_middlewareCreators.has<EndpointsMiddlewareCreator>())
+            if (!_middlewareCreators.provides<EndpointsMiddleware>())
             {
                 useEndpoints();
             }
         }
 
-        NativeResponse handleRequest(NativeRequest &req)
+        Task<NativeResponse> handleRequest(NativeRequest &req, const ConnectionInfo &info)
         {
             try
             {
-                Context context{req};
-                context.setServiceProvider(getServiceProvider().createScoped());
+                // all per-request objects are allocated from arena released when response is ready
+                RequestArena arena{&_arenaStatistics};
+                Context context{req, info, _defaultHeaders, arena, getServiceProvider(), _server.getExecutor()};
 
                 runMiddlewaresChain(context);
 
-                return context.getNativeResponse();
+                if (auto continuation = context.takeContinuation())
+                {
+                    co_await continuation;
+                }
+                co_return context.takeNativeResponse();
             }
             catch (std::exception &e)
             {
@@ -157,14 +295,26 @@ namespace sd
             {
                 getThisLogger() << Error{"Unknown exception occurred while processing request"};
             }
-            boost::beast::http::response<boost::beast::http::string_body> res{
-                boost::beast::http::status::internal_server_error, req.version()};
-            return res;
+            NativeResponse res{boost::beast::http::status::internal_server_error, req.version()};
+            _defaultHeaders.apply(res.base());
+            res.set(boost::beast::http::field::content_type, "application/problem+json");
+            res.body().appendStatic(InternalServerErrorResult::getBody());
+            res.prepare_payload();
+            co_return res;
+        }
+
+        Task<NativeResponse> handleSubRequest(NativeRequest &req, const ConnectionInfo &info, bool parallel)
+        {
+            if (parallel)
+            {
+                co_await schedule(_server.getExecutor());
+            }
+            co_return co_await handleRequest(req, info);
         }
 
         void runMiddlewaresChain(IContext &ctx) const
         {
-            MiddlewaresRunner runner{ctx, _middlewareCreators};
+            MiddlewaresRunner runner{ctx, _pipeline};
             runner.run();
         }
 
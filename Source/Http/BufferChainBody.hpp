@@ -0,0 +1,59 @@
+#pragma once
+
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/core/error.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "Http/BufferChain.hpp"
+
+namespace sd
+{
+    // Beast body backed by BufferChain, the serializer gets all segments at once so header and body go out in a
+    // single vectored write
+    struct BufferChainBody
+    {
+        using value_type = BufferChain;
+
+        static std::uint64_t size(const value_type &body) { return body.size(); }
+
+        class writer
+        {
+          private:
+            const value_type &_body;
+            std::vector<boost::asio::const_buffer> _buffers;
+
+          public:
+            using const_buffers_type = std::span<const boost::asio::const_buffer>;
+
+            template <bool isRequest, class Fields>
+            explicit writer(const boost::beast::http::header<isRequest, Fields> &, const value_type &body)
+                : _body(body)
+            {
+            }
+
+            void init(boost::beast::error_code &ec)
+            {
+                _buffers.reserve(_body.segmentsCount());
+                _body.forEach([this](std::string_view segment) {
+                    _buffers.emplace_back(segment.data(), segment.size());
+                });
+                ec = {};
+            }
+
+            boost::optional<std::pair<const_buffers_type, bool>> get(boost::beast::error_code &ec)
+            {
+                ec = {};
+                if (_buffers.empty())
+                {
+                    return boost::none;
+                }
+                return std::make_pair(const_buffers_type{_buffers}, false);
+            }
+        };
+    };
+} // namespace sd
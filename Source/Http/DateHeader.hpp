@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string_view>
+
+namespace sd
+{
+    // Per thread cached IMF-fixdate value of the Date header, formatted at most once per second
+    class DateHeader
+    {
+      private:
+        static constexpr size_t Length = 29; // "Sun, 06 Nov 1994 08:49:37 GMT"
+
+        struct Cache
+        {
+            std::chrono::sys_seconds second{};
+            std::array<char, Length> value{};
+        };
+
+      public:
+        static std::string_view get()
+        {
+            thread_local Cache cache;
+
+            auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+            if (now != cache.second)
+            {
+                format(now, cache.value);
+                cache.second = now;
+            }
+            return {cache.value.data(), cache.value.size()};
+        }
+
+      private:
+        static void format(std::chrono::sys_seconds time, std::array<char, Length> &out)
+        {
+            static constexpr std::string_view days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+            static constexpr std::string_view months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                                          "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+            auto dayPoint = std::chrono::floor<std::chrono::days>(time);
+            std::chrono::year_month_day date{dayPoint};
+            std::chrono::hh_mm_ss clock{time - dayPoint};
+            std::chrono::weekday weekday{dayPoint};
+
+            char *it = out.data();
+            auto putText = [&](std::string_view text) {
+                for (auto c : text)
+                {
+                    *it++ = c;
+                }
+            };
+            auto putNumber = [&](unsigned value, int digits) {
+                for (int i = digits - 1; i >= 0; --i)
+                {
+                    it[i] = static_cast<char>('0' + value % 10);
+                    value /= 10;
+                }
+                it += digits;
+            };
+
+            putText(days[weekday.c_encoding()]);
+            putText(", ");
+            putNumber(static_cast<unsigned>(date.day()), 2);
+            putText(" ");
+            putText(months[static_cast<unsigned>(date.month()) - 1]);
+            putText(" ");
+            putNumber(static_cast<unsigned>(static_cast<int>(date.year())), 4);
+            putText(" ");
+            putNumber(static_cast<unsigned>(clock.hours().count()), 2);
+            putText(":");
+            putNumber(static_cast<unsigned>(clock.minutes().count()), 2);
+            putText(":");
+            putNumber(static_cast<unsigned>(clock.seconds().count()), 2);
+            putText(" GMT");
+        }
+    };
+} // namespace sd
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/ServerSettings.hpp"
+#include "Engine/BoostBeastServer.hpp"
+#include "Http/DateHeader.hpp"
+#include "Http/HeaderBlock.hpp"
+
+namespace sd
+{
+    // Headers added to every response before it reaches user code, so handlers can still override them
+    class DefaultHeaders
+    {
+      private:
+        // header name resolved to beast field once, unknown names are set by name
+        struct Entry
+        {
+            boost::beast::http::field field;
+            std::string_view name;
+            std::string_view value;
+        };
+
+        bool _useDateHeader = true;
+        std::string _serverHeader;
+        std::vector<HeaderBlock::Ptr> _blocks; // keeps viewed names and values alive
+        std::vector<Entry> _entries;
+
+      public:
+        DefaultHeaders() = default;
+
+        DefaultHeaders(const ServerSettings &settings)
+            : _useDateHeader(settings.useDateHeader), _serverHeader(settings.serverHeader)
+        {
+        }
+
+        void add(HeaderBlock::Ptr block)
+        {
+            if (!block || block->empty())
+            {
+                return;
+            }
+            for (auto &field : *block)
+            {
+                _entries.push_back({boost::beast::http::string_to_field(field.name), field.name, field.value});
+            }
+            _blocks.push_back(std::move(block));
+        }
+
+        void apply(NativeResponseHeaders &headers) const
+        {
+            if (_useDateHeader)
+            {
+                headers.set(boost::beast::http::field::date, DateHeader::get());
+            }
+            if (!_serverHeader.empty())
+            {
+                headers.set(boost::beast::http::field::server, _serverHeader);
+            }
+            for (auto &entry : _entries)
+            {
+                if (entry.field != boost::beast::http::field::unknown)
+                {
+                    headers.set(entry.field, entry.value);
+                }
+                else
+                {
+                    headers.set(entry.name, entry.value);
+                }
+            }
+        }
+
+        // Ad hoc block added to single response, names are resolved on each call
+        static void apply(NativeResponseHeaders &headers, const HeaderBlock &block)
+        {
+            for (auto &field : block)
+            {
+                headers.set(field.name, field.value);
+            }
+        }
+    };
+} // namespace sd
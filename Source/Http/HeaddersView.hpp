@@ -12,12 +12,12 @@ namespace sd
     class HeaddersView : public virtual IHeaddersView
     {
       protected:
-        NativeRequestHeaders &_native;
+        NativeFields &_native;
 
       public:
         using Ptr = std::unique_ptr<HeaddersView>;
 
-        HeaddersView(NativeRequestHeaders &native) : _native(native) {}
+        HeaddersView(NativeFields &native) : _native(native) {}
 
         std::string_view getRequired(std::string_view name) const { return _native.at(name); }
 
@@ -25,7 +25,7 @@ namespace sd
 
         bool has(std::string_view name) const { return _native.find(name) != _native.end(); }
 
-        bool empty() const { return _native.begin() != _native.end(); }
+        bool empty() const { return _native.begin() == _native.end(); }
 
         size_t size() const { return std::distance(_native.begin(), _native.end()); }
 
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "Engine/BoostBeastServer.hpp"
+#include "Engine/ConnectionInfo.hpp"
+#include "Engine/RequestArena.hpp"
 #include "Http/CommonHeadders.hpp"
 #include "Http/CookiesView.hpp"
 #include "Http/HeaddersView.hpp"
@@ -18,18 +22,25 @@ namespace sd
     {
       private:
         NativeRequest &_native;
+        const ConnectionInfo &_connection;
+        RequestArena &_arena;
         const boost::url_view _url;
 
-        mutable HeaddersView::Ptr _headers;
-        mutable QueryParamsView::Ptr _query;
-        mutable CookiesView::Ptr _cookies;
+        mutable ArenaPtr<HeaddersView> _headers;
+        mutable ArenaPtr<QueryParamsView> _query;
+        mutable ArenaPtr<CookiesView> _cookies;
 
       public:
-        Request(NativeRequest &native) : _native(native), _url(Request::parseUrl(native.target())) {}
+        Request(NativeRequest &native, const ConnectionInfo &connection, RequestArena &arena)
+            : _native(native), _connection(connection), _arena(arena), _url(Request::parseUrl(native.target()))
+        {
+        }
 
         using Ptr = std::unique_ptr<Request>;
 
-        std::string getBody() const { return _native.body(); }
+        std::string_view getBody() const { return _native.body(); }
+
+        std::string takeBody() { return std::exchange(_native.body(), {}); }
 
         uint64_t getContentLength() const { return 1; }
 
@@ -39,7 +50,7 @@ namespace sd
         {
             if (!_cookies)
             {
-                _cookies = std::make_unique<CookiesView>(_native.base());
+                _cookies = _arena.make<CookiesView>(_native.base());
             }
             return *_cookies;
         }
@@ -50,13 +61,21 @@ namespace sd
         {
             if (!_headers)
             {
-                _headers = std::make_unique<HeaddersView>(_native.base());
+                _headers = _arena.make<HeaddersView>(_native.base());
             }
             return *_headers;
         }
 
         std::string_view getHost() const { return getHeaders().getRequired(headder::host); }
 
+        std::string_view getRemoteAddress() const { return _connection.remoteAddress; }
+
+        std::chrono::steady_clock::time_point getArrivalTime() const { return _connection.arrivalTime; }
+
+        bool isBatched() const { return _connection.batched; }
+
+        uint16_t getRemotePort() const { return _connection.remotePort; }
+
         bool isHttps() const { return _url.scheme_id() == boost::urls::scheme::https; }
 
         HttpMethod getMethod() const
@@ -89,7 +108,7 @@ namespace sd
         {
             if (!_query)
             {
-                _query = std::make_unique<QueryParamsView>(_url.params());
+                _query = _arena.make<QueryParamsView>(_url.params());
             }
             return *_query;
         }
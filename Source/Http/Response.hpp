@@ -3,6 +3,8 @@
 #include <memory>
 
 #include "Engine/BoostBeastServer.hpp"
+#include "Engine/RequestArena.hpp"
+#include "Http/DefaultHeaders.hpp"
 #include "Http/Headders.hpp"
 #include "Http/IResponse.hpp"
 #include "Http/Request.hpp"
@@ -13,38 +15,78 @@ namespace sd
     {
       private:
         Request &_request;
+        RequestArena &_arena;
         NativeResponse _native;
 
-        Headders::Ptr _headers;
+        ArenaPtr<Headders> _headers;
+        bool _written = false;
 
       public:
         using Ptr = std::unique_ptr<Response>;
 
-        Response(Request &request)
-            : _request(request), _native(boost::beast::http::status::ok, _request.getHttpVersion())
+        Response(Request &request, const DefaultHeaders &defaultHeaders, RequestArena &arena)
+            : _request(request), _arena(arena), _native(boost::beast::http::status::ok, _request.getHttpVersion())
         {
+            defaultHeaders.apply(_native.base());
         }
 
-        void setStatusCode(int statusCode) { _native.result(statusCode); }
+        void setStatusCode(int statusCode)
+        {
+            _native.result(statusCode);
+            _written = true;
+        }
+
+        int getStatusCode() const { return _native.result_int(); }
 
         IHeadders &getHeaders()
         {
             if (!_headers)
             {
-                _headers = std::make_unique<Headders>(_native.base());
+                _headers = _arena.make<Headders>(_native.base());
             }
             return *_headers;
         }
 
-        void setBody(const std::string value) { _native.body() = std::move(value); }
+        void addHeaders(const HeaderBlock &headers) { DefaultHeaders::apply(_native.base(), headers); }
 
-        NativeResponse getNative()
+        void setBody(std::string value) { setBody(BufferChain{std::move(value)}); }
+
+        void setBody(BufferChain body)
         {
-            _native.prepare_payload();
-            return _native;
+            _native.body() = std::move(body);
+            _written = true;
+        }
+
+        // body can be appended to through returned reference
+        BufferChain &getBody()
+        {
+            _written = true;
+            return _native.body();
+        }
+
+        bool isWritten() const { return _written; }
+
+        // Response is moved out, it must not be used afterwards
+        NativeResponse takeNative()
+        {
+            if (hasPayload())
+            {
+                _native.prepare_payload();
+            }
+            return std::move(_native);
         }
 
         ~Response() = default;
+
+      private:
+        // 1xx, 204 and 304 responses have no payload, Content-Length is not added to them
+        bool hasPayload() const
+        {
+            namespace http = boost::beast::http;
+            auto status = _native.result();
+            return http::to_status_class(status) != http::status_class::informational &&
+                   status != http::status::no_content && status != http::status::not_modified;
+        }
     };
 
 } // namespace sd
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <deque>
 #include <memory>
+#include <typeinfo>
 
 #include "Engine/IContext.hpp"
 #include "Middlewares/EndpointsMiddleware.hpp"
@@ -36,6 +37,18 @@ namespace sd
             return false;
         }
 
+        template <class Middleware> bool provides() const
+        {
+            for (auto &creator : _middlewareCreators)
+            {
+                if (creator->provides(typeid(Middleware)))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         auto begin() const { return _middlewareCreators.begin(); }
 
         auto end() const { return _middlewareCreators.end(); }
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdexcept>
+#include <vector>
+
+#include "Middlewares/IMiddleware.hpp"
+#include "Middlewares/IMiddlewareCreator.hpp"
+#include "Middlewares/MiddlewareCreators.hpp"
+
+namespace sd
+{
+    // Middlewares chain flattened on application init, singleton middlewares are created here once so running the
+    // chain allocates only for scoped middlewares
+    class MiddlewarePipeline
+    {
+      public:
+        struct Step
+        {
+            IMiddleware *middleware = nullptr;     // set for singleton middleware
+            IMiddlewareCreator *creator = nullptr; // set for scoped middleware
+        };
+
+        using Iterator = std::vector<Step>::const_iterator;
+
+      private:
+        std::vector<IMiddleware::Ptr> _singletons;
+        std::vector<Step> _steps;
+
+      public:
+        void build(const MiddlewareCreators &creators)
+        {
+            _singletons.clear();
+            _steps.clear();
+            for (auto &creator : creators)
+            {
+                if (!creator)
+                {
+                    throw std::runtime_error("Middleware creator is null");
+                }
+                if (creator->getLifetime() == MiddlewareLifetime::Scoped)
+                {
+                    _steps.push_back({.creator = creator.get()});
+                    continue;
+                }
+                auto &middleware = _singletons.emplace_back(creator->createSingleton());
+                if (!middleware)
+                {
+                    throw std::runtime_error("Singleton middleware creator returned null");
+                }
+                _steps.push_back({.middleware = middleware.get()});
+            }
+        }
+
+        Iterator begin() const { return _steps.begin(); }
+
+        Iterator end() const { return _steps.end(); }
+
+        size_t size() const { return _steps.size(); }
+    };
+} // namespace sd
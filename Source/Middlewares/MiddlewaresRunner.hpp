@@ -1,13 +1,11 @@
 #pragma once
 
-#include <deque>
 #include <exception>
-#include <iostream>
 
 #include "Engine/IContext.hpp"
+#include "Http/Results.hpp"
 #include "Middlewares/IMiddleware.hpp"
-#include "Middlewares/MiddlewareCreator.hpp"
-#include "Middlewares/MiddlewareCreators.hpp"
+#include "Middlewares/MiddlewarePipeline.hpp"
 
 namespace sd
 {
@@ -15,12 +13,12 @@ namespace sd
     {
       private:
         IContext &_ctx;
-        MiddlewareCreators::Iterator _current;
-        MiddlewareCreators::Iterator _end;
+        MiddlewarePipeline::Iterator _current;
+        MiddlewarePipeline::Iterator _end;
 
       public:
-        MiddlewaresRunner(IContext &ctx, const MiddlewareCreators &creators)
-            : _ctx(ctx), _current(creators.begin()), _end(creators.end())
+        MiddlewaresRunner(IContext &ctx, const MiddlewarePipeline &pipeline)
+            : _ctx(ctx), _current(pipeline.begin()), _end(pipeline.end())
         {
         }
         void run() { next(); }
@@ -30,24 +28,25 @@ namespace sd
       private:
         void next() final
         {
-            if (auto middleware = getNextMiddleware())
+            if (_current == _end)
             {
-                middleware->next(_ctx, *this);
+                // nothing handled the request, middleware that wrote its own response keeps it
+                if (!_ctx.getRoutingData().getEndpoint() && !_ctx.getResponse().isWritten())
+                {
+                    NotFoundResult{}.execute(_ctx.getResponse());
+                }
+                return;
             }
-        }
-
-        IMiddleware::Ptr getNextMiddleware()
-        {
-            if (_current == _end)
+            auto &step = *(_current++);
+            if (step.middleware)
             {
-                return nullptr;
+                return step.middleware->next(_ctx, *this);
             }
-            if (const auto &middlewareCreator = *(_current++))
+            // scoped middleware lives until the rest of the chain returns
+            if (auto middleware = step.creator->create(_ctx))
             {
-                return middlewareCreator->create(_ctx);
+                middleware->next(_ctx, *this);
             }
-            // TODO throw
-            return nullptr;
         }
     };
-} // namespace sd
\ No newline at end of file
+} // namespace sd
@@ -0,0 +1,421 @@
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+#include <tao/json/from_string.hpp>
+#include <tao/json/msgpack.hpp>
+#include <vector>
+
+#include "Middlewares/IAuthorizer.hpp"
+#include "SevenBitRest.hpp"
+
+using namespace std::string_literals;
+
+class TestServerTest : public ::testing::Test
+{
+  protected:
+    sd::WebApplication app = sd::WebApplicationBuilder{}.build();
+    sd::TestServer server{app};
+};
+
+TEST_F(TestServerTest, ShouldRunEndpoint)
+{
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    auto response = server.get("/hello");
+
+    EXPECT_EQ(response.statusCode, 200);
+    EXPECT_EQ(response.body, "Hello, world!");
+    EXPECT_EQ(response.getHeader("content-type"), "text/plain; charset=utf-8");
+    EXPECT_EQ(response.getHeader("Content-Length"), "13");
+}
+
+TEST_F(TestServerTest, ShouldBindRouteAndQuery)
+{
+    app.mapGet("/users/{id:int}", [](sd::FromRouteInt<"id"> id, sd::FromQuery<"name"> name) {
+        return std::to_string(*id) + ":" + *name;
+    });
+
+    auto response = server.get("/users/42?name=john");
+
+    EXPECT_EQ(response.statusCode, 200);
+    EXPECT_EQ(response.body, "42:john");
+}
+
+TEST_F(TestServerTest, ShouldReturnValidationProblem)
+{
+    app.mapGet("/items", [](sd::FromQueryInt<"page"> page) { return std::to_string(*page); });
+
+    auto response = server.get("/items?page=x");
+
+    EXPECT_EQ(response.statusCode, 400);
+    EXPECT_NE(response.body.find("page"), std::string::npos);
+}
+
+TEST_F(TestServerTest, ShouldReturnNotFound)
+{
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    EXPECT_EQ(server.get("/missing").statusCode, 404);
+    EXPECT_EQ(server.remove("/hello").statusCode, 404);
+}
+
+TEST_F(TestServerTest, ShouldPassBodyAndHeaders)
+{
+    app.mapPost("/echo", [](sd::FromBody<std::string> body, sd::FromHeader<"X-Tag"> tag) {
+        return *tag + ":" + *body;
+    });
+
+    auto response = server.send(
+        {.method = sd::HttpMethod::Post, .target = "/echo", .headers = {{"X-Tag", "a"}}, .body = "payload"});
+
+    EXPECT_EQ(response.statusCode, 200);
+    EXPECT_EQ(response.body, "a:payload");
+}
+
+TEST_F(TestServerTest, ShouldRunMiddlewares)
+{
+    app.use([](sd::IContext &ctx, sd::INextCallback &next) {
+        next();
+        ctx.getResponse().getHeaders().add("X-Middleware", "done");
+    });
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    auto response = server.get("/hello");
+
+    EXPECT_EQ(response.statusCode, 200);
+    EXPECT_EQ(response.getHeader("X-Middleware"), "done");
+    EXPECT_EQ(server.get("/hello").getHeader("X-Middleware"), "done");
+}
+
+TEST_F(TestServerTest, ShouldWaitForAsyncEndpoint)
+{
+    app.mapGet("/async", []() -> sd::Task<std::string> { co_return "async"s; });
+
+    auto response = server.get("/async");
+
+    EXPECT_EQ(response.statusCode, 200);
+    EXPECT_EQ(response.body, "async");
+}
+
+TEST_F(TestServerTest, ShouldRunBatchThroughPipeline)
+{
+    app.mapGet("/users/{id:int}", [](sd::FromRouteInt<"id"> id) { return std::to_string(*id); });
+    app.mapBatch();
+
+    auto response = server.post("/batch", R"([{"path": "/users/1"}, {"path": "/missing"}])");
+
+    EXPECT_EQ(response.statusCode, 200);
+    auto json = tao::json::basic_from_string<sd::JsonTraits>(response.body);
+    ASSERT_EQ(json.get_array().size(), 2);
+    EXPECT_EQ(json[0].at("status").as<int>(), 200);
+    EXPECT_EQ(json[0].at("body").get_string(), "1");
+    EXPECT_EQ(json[1].at("status").as<int>(), 404);
+}
+
+TEST_F(TestServerTest, ShouldInheritOnlyCallerHeadersInBatch)
+{
+    app.mapGet("/headers", [](sd::IContext &ctx) {
+        auto &headers = ctx.getRequest().getHeaders();
+        ctx.getResponse().setBody(std::string{headers.get("Authorization").value_or("-")} + " " +
+                                  std::string{headers.get("If-None-Match").value_or("-")});
+    });
+    app.mapBatch();
+
+    auto response = server.send({.method = sd::HttpMethod::Post,
+                                 .target = "/batch",
+                                 .headers = {{"Content-Type", "application/json"},
+                                             {"Authorization", "Bearer batch"},
+                                             {"If-None-Match", "\"tag\""}},
+                                 .body = R"([{"path": "/headers"},
+                                             {"path": "/headers", "headers": {"Authorization": "Bearer item"}}])"});
+
+    auto json = tao::json::basic_from_string<sd::JsonTraits>(response.body);
+    ASSERT_EQ(json.get_array().size(), 2);
+    EXPECT_EQ(json[0].at("body").get_string(), "Bearer batch -");
+    EXPECT_EQ(json[1].at("body").get_string(), "Bearer item -");
+}
+
+TEST_F(TestServerTest, ShouldKeepRepeatedBatchResponseHeadersSeparate)
+{
+    app.mapGet("/login", [](sd::IContext &ctx) {
+        auto &headers = ctx.getResponse().getHeaders();
+        headers.add("Set-Cookie", "a=1; Expires=Wed, 21 Oct 2026 07:28:00 GMT");
+        headers.add("Set-Cookie", "b=2");
+        ctx.getResponse().setBody("ok");
+    });
+    app.mapBatch();
+
+    auto response = server.post("/batch", R"([{"path": "/login"}])");
+
+    auto json = tao::json::basic_from_string<sd::JsonTraits>(response.body);
+    auto &cookies = json[0].at("headers").at("Set-Cookie").get_array();
+    ASSERT_EQ(cookies.size(), 2);
+    EXPECT_EQ(cookies[0].get_string(), "a=1; Expires=Wed, 21 Oct 2026 07:28:00 GMT");
+    EXPECT_EQ(cookies[1].get_string(), "b=2");
+}
+
+TEST_F(TestServerTest, ShouldRunBatchInParallel)
+{
+    app.mapGet("/users/{id:int}", [](sd::FromRouteInt<"id"> id) { return std::to_string(*id); });
+    app.mapBatch("/batch", {.parallel = true});
+
+    auto response = server.post("/batch", R"([{"path": "/users/1"}, {"path": "/users/2"}, {"path": "/users/3"}])");
+
+    EXPECT_EQ(response.statusCode, 200);
+    auto json = tao::json::basic_from_string<sd::JsonTraits>(response.body);
+    ASSERT_EQ(json.get_array().size(), 3);
+    EXPECT_EQ(json[0].at("body").get_string(), "1");
+    EXPECT_EQ(json[1].at("body").get_string(), "2");
+    EXPECT_EQ(json[2].at("body").get_string(), "3");
+}
+
+TEST_F(TestServerTest, ShouldRunMsgPackBatch)
+{
+    app.mapGet("/users/{id:int}", [](sd::FromRouteInt<"id"> id) { return std::to_string(*id); });
+    app.mapBatch();
+
+    sd::Json batch = sd::Json::array_t{{{"path", "/users/7"}}};
+    auto response = server.post("/batch", tao::json::msgpack::to_string(batch), "application/msgpack");
+
+    EXPECT_EQ(response.statusCode, 200);
+    EXPECT_EQ(response.getHeader("Content-Type"), "application/msgpack");
+    auto json = tao::json::msgpack::basic_from_string<sd::JsonTraits>(response.body);
+    ASSERT_EQ(json.get_array().size(), 1);
+    EXPECT_EQ(json[0].at("status").as<int>(), 200);
+    EXPECT_EQ(json[0].at("body").get_string(), "7");
+}
+
+TEST_F(TestServerTest, ShouldRejectInvalidBatch)
+{
+    app.mapGet("/users/{id:int}", [](sd::FromRouteInt<"id"> id) { return std::to_string(*id); });
+    app.mapBatch("/batch", {.maxRequests = 3});
+
+    auto invalid = server.post("/batch", R"([1, {"path": "users"}, {"method": "FOO", "path": "/users/1"}])");
+    auto tooBig = server.post("/batch", R"([{"path": "/users/1"}, {"path": "/users/2"}, {"path": "/users/3"},
+                                            {"path": "/users/4"}])");
+
+    EXPECT_EQ(invalid.statusCode, 200);
+    auto json = tao::json::basic_from_string<sd::JsonTraits>(invalid.body);
+    ASSERT_EQ(json.get_array().size(), 3);
+    for (auto &result : json.get_array())
+    {
+        EXPECT_EQ(result.at("status").as<int>(), 400);
+    }
+    EXPECT_EQ(tooBig.statusCode, 400);
+    EXPECT_EQ(server.post("/batch", R"({"path": "/users/1"})").statusCode, 400);
+}
+
+TEST_F(TestServerTest, ShouldRejectNestedBatch)
+{
+    app.mapBatch();
+
+    auto response = server.post("/batch", R"([{"method": "POST", "path": "/batch", "body": []},
+                                              {"method": "POST", "path": "/%62atch", "body": []}])");
+
+    EXPECT_EQ(response.statusCode, 200);
+    auto json = tao::json::basic_from_string<sd::JsonTraits>(response.body);
+    ASSERT_EQ(json.get_array().size(), 2);
+    EXPECT_EQ(json[0].at("status").as<int>(), 400);
+    EXPECT_EQ(json[1].at("status").as<int>(), 400);
+}
+
+TEST_F(TestServerTest, ShouldAddDefaultHeaders)
+{
+    app.useHeaders({{"X-Frame-Options", "DENY"}, {"X-Custom", "1"}});
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    auto response = server.get("/hello");
+
+    EXPECT_EQ(response.getHeader("X-Frame-Options"), "DENY");
+    EXPECT_EQ(response.getHeader("X-Custom"), "1");
+    EXPECT_TRUE(response.hasHeader("Date"));
+}
+
+TEST_F(TestServerTest, ShouldKeepResponseWrittenByMiddleware)
+{
+    app.use([](sd::IContext &ctx, sd::INextCallback &next) {
+        if (ctx.getRequest().getPath() == "/health")
+        {
+            ctx.getResponse().setBody("ok");
+        }
+        ctx.getResponse().getHeaders().add("X-Request-Id", "1");
+        next();
+    });
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    auto health = server.get("/health");
+    auto missing = server.get("/missing");
+
+    EXPECT_EQ(health.statusCode, 200);
+    EXPECT_EQ(health.body, "ok");
+    EXPECT_EQ(missing.statusCode, 404);
+    EXPECT_EQ(missing.getHeader("X-Request-Id"), "1");
+}
+
+TEST_F(TestServerTest, ShouldRejectUnauthenticatedAndForbiddenCallers)
+{
+    struct AdminAuthorizer final : sd::IAuthorizer
+    {
+        sd::AuthorizationResult authorize(sd::IContext &ctx) const
+        {
+            return {ctx.isAuthenticated() && ctx.getUser().isInRole("admin")};
+        }
+    };
+    app.use([](sd::IContext &ctx, sd::INextCallback &next) {
+        auto &headers = ctx.getRequest().getHeaders();
+        if (headers.has("X-Role"))
+        {
+            sd::ClaimsIdentity identity{{sd::Claim{sd::ClaimTypes::Role, std::string{headers.getRequired("X-Role")}}},
+                                        "Test"};
+            ctx.setUser(std::make_unique<sd::ClaimsPrincipal>(std::move(identity)));
+        }
+        next();
+    });
+    app.mapGet("/admin", []() { return "secret"s; })->addAuthorization(std::make_unique<AdminAuthorizer>());
+
+    auto anonymous = server.get("/admin");
+    EXPECT_EQ(anonymous.statusCode, 401);
+    EXPECT_EQ(anonymous.getHeader("WWW-Authenticate"), "Bearer");
+    auto forbidden = server.get("/admin", {{"X-Role", "user"}});
+    EXPECT_EQ(forbidden.statusCode, 403);
+    EXPECT_FALSE(forbidden.hasHeader("WWW-Authenticate"));
+    EXPECT_EQ(server.get("/admin", {{"X-Role", "admin"}}).statusCode, 200);
+}
+
+TEST_F(TestServerTest, ShouldSendAuthorizerChallengeToUnauthenticatedCaller)
+{
+    struct BasicAuthorizer final : sd::IAuthorizer
+    {
+        sd::AuthorizationResult authorize(sd::IContext &) const
+        {
+            return {.isAuthorized = false, .challenge = "Basic realm=\"admin\""};
+        }
+    };
+    app.mapGet("/admin", []() { return "secret"s; })->addAuthorization(std::make_unique<BasicAuthorizer>());
+
+    auto response = server.get("/admin");
+
+    EXPECT_EQ(response.statusCode, 401);
+    EXPECT_EQ(response.getHeader("WWW-Authenticate"), "Basic realm=\"admin\"");
+}
+
+TEST_F(TestServerTest, ShouldThrowWhenEndpointChangedAfterStart)
+{
+    auto endpoint = app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    EXPECT_EQ(server.get("/hello").statusCode, 200);
+    EXPECT_THROW(endpoint->addPreTask([](sd::IContext &) { return true; }), std::runtime_error);
+    EXPECT_THROW(endpoint->useCoalescing(), std::runtime_error);
+}
+
+TEST_F(TestServerTest, ShouldShedRequestQueuedLongerThanLatencyTarget)
+{
+    app.useConcurrencyLimiter({.latencyTarget = std::chrono::milliseconds{100}});
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    auto fresh = server.get("/hello");
+    auto queued =
+        server.send({.target = "/hello", .arrivalTime = std::chrono::steady_clock::now() - std::chrono::seconds{1}});
+
+    EXPECT_EQ(fresh.statusCode, 200);
+    EXPECT_EQ(queued.statusCode, 503);
+}
+
+TEST_F(TestServerTest, ShouldNotShedSequentialBatchRequestsWaitingForEarlierOnes)
+{
+    std::vector<std::chrono::steady_clock::time_point> arrivals, completions;
+    app.useConcurrencyLimiter({.latencyTarget = std::chrono::milliseconds{100}});
+    app.mapGet("/slow", [&](sd::IContext &ctx) {
+        arrivals.push_back(ctx.getRequest().getArrivalTime());
+        completions.push_back(std::chrono::steady_clock::now());
+    });
+    app.mapBatch()->setPriority(sd::RequestPriority::Critical);
+
+    // batch waited longer than latency target, its sub-requests are measured from their own dispatch
+    auto response = server.send({.method = sd::HttpMethod::Post,
+                                 .target = "/batch",
+                                 .headers = {{"Content-Type", "application/json"}},
+                                 .body = R"([{"path": "/slow"}, {"path": "/slow"}, {"path": "/slow"}])",
+                                 .arrivalTime = std::chrono::steady_clock::now() - std::chrono::seconds{1}});
+
+    EXPECT_EQ(response.statusCode, 200);
+    auto json = tao::json::basic_from_string<sd::JsonTraits>(response.body);
+    ASSERT_EQ(json.get_array().size(), 3);
+    EXPECT_EQ(json[2].at("status").as<int>(), 200);
+    ASSERT_EQ(arrivals.size(), 3);
+    EXPECT_GE(arrivals[1], completions[0]);
+    EXPECT_GE(arrivals[2], completions[1]);
+}
+
+TEST_F(TestServerTest, ShouldRefuseOutputCacheOnEndpointWithPreTask)
+{
+    app.useOutputCache();
+    auto endpoint = app.mapGet("/hello", []() { return "Hello, world!"s; });
+    endpoint->addPreTask([](sd::IContext &) { return true; });
+    endpoint->cacheOutput();
+
+    EXPECT_THROW(server.get("/hello"), std::runtime_error);
+}
+
+TEST_F(TestServerTest, ShouldNotShareCachedOutputBetweenCallers)
+{
+    int calls = 0;
+    app.useOutputCache();
+    app.use([](sd::IContext &ctx, sd::INextCallback &next) {
+        if (ctx.getRequest().getHeaders().has("X-User"))
+        {
+            ctx.setUser(std::make_unique<sd::ClaimsPrincipal>(sd::ClaimsIdentity{{}, "Test"}));
+        }
+        next();
+    });
+    app.mapGet("/profile", [&calls]() { return std::to_string(++calls); })->cacheOutput();
+
+    EXPECT_EQ(server.get("/profile", {{"X-User", "john"}}).body, "1");
+    EXPECT_EQ(server.get("/profile").body, "2");
+    EXPECT_EQ(server.get("/profile").body, "2");
+    EXPECT_EQ(server.get("/profile", {{"Authorization", "Bearer token"}}).body, "3");
+    EXPECT_EQ(server.get("/profile", {{"Cookie", "session=john"}}).body, "4");
+}
+
+TEST_F(TestServerTest, ShouldKeyCachedOutputByCookieWhenPolicyVariesByIt)
+{
+    int calls = 0;
+    app.useOutputCache();
+    app.mapGet("/profile", [&calls]() { return std::to_string(++calls); })->cacheOutput({.varyByHeaders = {"Cookie"}});
+
+    EXPECT_EQ(server.get("/profile", {{"Cookie", "session=john"}}).body, "1");
+    EXPECT_EQ(server.get("/profile", {{"Cookie", "session=john"}}).body, "1");
+    EXPECT_EQ(server.get("/profile", {{"Cookie", "session=anna"}}).body, "2");
+}
+
+TEST_F(TestServerTest, ShouldAnswerMatchingIfNoneMatchWithoutContentHeaders)
+{
+    app.useETags();
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    auto first = server.get("/hello");
+    auto etag = std::string{first.getHeader("ETag")};
+    auto cached = server.get("/hello", {{"If-None-Match", etag}});
+
+    EXPECT_EQ(first.statusCode, 200);
+    ASSERT_FALSE(etag.empty());
+    EXPECT_EQ(cached.statusCode, 304);
+    EXPECT_EQ(cached.getHeader("ETag"), etag);
+    EXPECT_TRUE(cached.body.empty());
+    EXPECT_FALSE(cached.hasHeader("Content-Length"));
+    EXPECT_FALSE(cached.hasHeader("Content-Type"));
+    EXPECT_EQ(server.get("/hello", {{"If-None-Match", "\"other\""}}).statusCode, 200);
+}
+
+TEST_F(TestServerTest, ShouldNotHashEmptyHeadBody)
+{
+    app.useETags();
+    app.mapHead("/hello", []() {});
+    app.mapHead("/tagged", [](sd::IContext &ctx) { ctx.getResponse().getHeaders().set("ETag", "\"v1\""); });
+
+    EXPECT_FALSE(server.send({.method = sd::HttpMethod::Head, .target = "/hello"}).hasHeader("ETag"));
+    auto tagged = server.send(
+        {.method = sd::HttpMethod::Head, .target = "/tagged", .headers = {{"If-None-Match", "\"v1\""}}});
+    EXPECT_EQ(tagged.statusCode, 304);
+    EXPECT_EQ(tagged.getHeader("ETag"), "\"v1\"");
+}
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Engine/BoostBeastServer.hpp"
+#include "Http/BufferChain.hpp"
+
+TEST(BufferChainTest, ShouldKeepSegmentsWithoutCopying)
+{
+    auto shared = std::make_shared<const std::string>("shared ");
+    std::string_view staticData = "static";
+    sd::BufferChain other{"other"};
+    sd::BufferChain chain{"owned "};
+    chain.append(shared);
+    chain.append(std::string{});
+    chain.appendStatic(staticData);
+    chain.append(std::move(other));
+
+    std::vector<const char *> segments;
+    chain.forEach([&](std::string_view segment) { segments.push_back(segment.data()); });
+
+    EXPECT_EQ(chain.toString(), "owned shared staticother");
+    EXPECT_EQ(chain.size(), 24);
+    ASSERT_EQ(chain.segmentsCount(), 4);
+    EXPECT_EQ(segments[1], shared->data());
+    EXPECT_EQ(segments[2], staticData.data());
+}
+
+TEST(BufferChainTest, ShouldWriteHeaderAndSegmentsTogether)
+{
+    namespace http = boost::beast::http;
+    std::string_view staticData = "world";
+    sd::NativeResponse response{http::status::ok, 11};
+    response.body().append(std::string{"hello "});
+    response.body().appendStatic(staticData);
+    response.prepare_payload();
+
+    http::serializer<false, sd::BufferChainBody> serializer{response};
+    boost::beast::error_code ec;
+    size_t writes = 0;
+    std::string written;
+    std::vector<const void *> buffers;
+    while (!serializer.is_done())
+    {
+        serializer.next(ec, [&](boost::beast::error_code &, const auto &sequence) {
+            ++writes;
+            auto end = boost::asio::buffer_sequence_end(sequence);
+            for (auto it = boost::asio::buffer_sequence_begin(sequence); it != end; ++it)
+            {
+                boost::asio::const_buffer buffer{*it};
+                buffers.push_back(buffer.data());
+                written.append(static_cast<const char *>(buffer.data()), buffer.size());
+            }
+            serializer.consume(boost::asio::buffer_size(sequence));
+        });
+        ASSERT_FALSE(ec);
+    }
+
+    EXPECT_EQ(writes, 1);
+    EXPECT_EQ(written.substr(written.find("\r\n\r\n") + 4), "hello world");
+    EXPECT_NE(std::find(buffers.begin(), buffers.end(), staticData.data()), buffers.end());
+}
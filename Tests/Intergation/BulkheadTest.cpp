@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <optional>
+
+#include "Common/InlineExecutor.hpp"
+#include "Common/Json.hpp"
+#include "Common/Task.hpp"
+#include "Engine/Bulkhead.hpp"
+
+namespace
+{
+    // Collects handles posted by other threads, test resumes them
+    struct QueueExecutor final : sd::IExecutor
+    {
+        std::mutex mutex;
+        std::condition_variable signal;
+        std::deque<std::coroutine_handle<>> posted;
+
+        void post(std::coroutine_handle<> handle)
+        {
+            std::lock_guard lock{mutex};
+            posted.push_back(handle);
+            signal.notify_one();
+        }
+
+        bool runningInThisThread() const { return false; }
+
+        std::coroutine_handle<> tryTake()
+        {
+            std::lock_guard lock{mutex};
+            if (posted.empty())
+            {
+                return nullptr;
+            }
+            auto handle = posted.front();
+            posted.pop_front();
+            return handle;
+        }
+
+        std::coroutine_handle<> take()
+        {
+            std::unique_lock lock{mutex};
+            if (!signal.wait_for(lock, std::chrono::seconds{1}, [this] { return !posted.empty(); }))
+            {
+                return nullptr;
+            }
+            auto handle = posted.front();
+            posted.pop_front();
+            return handle;
+        }
+    };
+
+    sd::Task<bool> wait(sd::Bulkhead &bulkhead, sd::IExecutor &executor) { co_return co_await bulkhead.enter(executor); }
+
+    void start(sd::Bulkhead &bulkhead, sd::IExecutor &executor, std::optional<bool> &admitted)
+    {
+        sd::startTask(wait(bulkhead, executor),
+                      [&](std::exception_ptr, std::optional<bool> result) { admitted = result.value_or(false); });
+    }
+
+    sd::Task<> enterAndLeave(sd::Bulkhead &bulkhead, sd::IExecutor &executor, int &depth, int &maxDepth)
+    {
+        if (co_await bulkhead.enter(executor))
+        {
+            maxDepth = std::max(maxDepth, ++depth);
+            {
+                // leaving hands slot to next waiter
+                sd::Bulkhead::Slot slot{bulkhead};
+            }
+            --depth;
+        }
+    }
+} // namespace
+
+TEST(BulkheadTest, ShouldQueueAndHandOverSlot)
+{
+    sd::Bulkhead bulkhead{{.maxConcurrency = 1, .maxQueue = 1, .queueTimeout = std::chrono::seconds{10}}};
+    std::optional<sd::Bulkhead::Slot> slot;
+
+    ASSERT_EQ(bulkhead.tryEnter(), sd::Bulkhead::Admission::Admitted);
+    slot.emplace(bulkhead);
+    ASSERT_EQ(bulkhead.tryEnter(), sd::Bulkhead::Admission::MustWait);
+
+    QueueExecutor executor;
+    std::optional<bool> admitted;
+    start(bulkhead, executor, admitted);
+    EXPECT_FALSE(admitted);
+    EXPECT_EQ(bulkhead.getStatistics().queued, 1);
+    EXPECT_EQ(bulkhead.tryEnter(), sd::Bulkhead::Admission::Rejected);
+
+    slot.reset();
+    auto waiter = executor.take();
+    ASSERT_TRUE(waiter);
+    waiter.resume();
+    EXPECT_EQ(admitted, true);
+    EXPECT_EQ(bulkhead.getStatistics().inFlight, 1);
+    EXPECT_EQ(bulkhead.getStatistics().rejected, 1);
+}
+
+TEST(BulkheadTest, ShouldRejectExpiredWaiters)
+{
+    sd::Bulkhead bulkhead{{.maxConcurrency = 1, .maxQueue = 1, .queueTimeout = std::chrono::milliseconds{1}}};
+    ASSERT_EQ(bulkhead.tryEnter(), sd::Bulkhead::Admission::Admitted);
+    sd::Bulkhead::Slot slot{bulkhead};
+
+    QueueExecutor executor;
+    std::optional<bool> admitted;
+    start(bulkhead, executor, admitted);
+
+    // timer expires waiter without further calls to bulkhead and posts it instead of resuming it
+    auto waiter = executor.take();
+    ASSERT_TRUE(waiter);
+    EXPECT_FALSE(admitted);
+    waiter.resume();
+
+    EXPECT_EQ(admitted, false);
+    EXPECT_EQ(bulkhead.getStatistics().timedOut, 1);
+    EXPECT_EQ(bulkhead.getStatistics().queued, 0);
+}
+
+TEST(BulkheadTest, ShouldNotNestResumedWaiters)
+{
+    sd::Bulkhead bulkhead{{.maxConcurrency = 1, .maxQueue = 100, .queueTimeout = std::chrono::seconds{10}}};
+    QueueExecutor executor;
+    std::optional<sd::Bulkhead::Slot> slot;
+    ASSERT_EQ(bulkhead.tryEnter(), sd::Bulkhead::Admission::Admitted);
+    slot.emplace(bulkhead);
+    int depth = 0;
+    int maxDepth = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        sd::startTask(enterAndLeave(bulkhead, executor, depth, maxDepth), [](std::exception_ptr) {});
+    }
+
+    slot.reset();
+    while (auto waiter = executor.tryTake())
+    {
+        waiter.resume();
+    }
+
+    EXPECT_EQ(maxDepth, 1);
+    EXPECT_EQ(bulkhead.getStatistics().inFlight, 0);
+    EXPECT_EQ(bulkhead.getStatistics().queued, 0);
+}
+
+TEST(BulkheadTest, ShouldRejectQueuedWaitOnInlineExecutor)
+{
+    sd::Bulkhead bulkhead{{.maxConcurrency = 1, .maxQueue = 1, .queueTimeout = std::chrono::seconds{10}}};
+    ASSERT_EQ(bulkhead.tryEnter(), sd::Bulkhead::Admission::Admitted);
+    sd::Bulkhead::Slot slot{bulkhead};
+
+    sd::InlineExecutor executor;
+    std::optional<bool> admitted;
+    start(bulkhead, executor, admitted);
+
+    EXPECT_EQ(admitted, false);
+    EXPECT_EQ(bulkhead.getStatistics().queued, 0);
+    EXPECT_EQ(bulkhead.getStatistics().rejected, 1);
+}
+
+TEST(BulkheadTest, ShouldReleaseWaitersWhenDestroyed)
+{
+    QueueExecutor executor;
+    std::optional<bool> admitted;
+    {
+        sd::Bulkhead bulkhead{{.maxConcurrency = 1, .maxQueue = 1, .queueTimeout = std::chrono::seconds{10}}};
+        ASSERT_EQ(bulkhead.tryEnter(), sd::Bulkhead::Admission::Admitted);
+        start(bulkhead, executor, admitted);
+        EXPECT_FALSE(admitted);
+    }
+
+    auto waiter = executor.tryTake();
+    ASSERT_TRUE(waiter);
+    waiter.resume();
+
+    EXPECT_EQ(admitted, false);
+}
+
+TEST(BulkheadTest, ShouldReadOptionsFromJson)
+{
+    sd::Json section = sd::Json::object_t{{"maxConcurrency", 4}, {"queueTimeoutMs", 50}};
+
+    auto options = sd::BulkheadOptions::fromJson(&section, {.maxQueue = 7});
+
+    EXPECT_EQ(options.maxConcurrency, 4);
+    EXPECT_EQ(options.maxQueue, 7);
+    EXPECT_EQ(options.queueTimeout, std::chrono::milliseconds{50});
+}
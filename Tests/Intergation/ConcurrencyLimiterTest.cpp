@@ -0,0 +1,71 @@
+#include <chrono>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "Middlewares/ConcurrencyLimiter.hpp"
+
+TEST(ConcurrencyLimiterTest, ShouldShedOverLimit)
+{
+    sd::ConcurrencyLimiter limiter{{.initialLimit = 10, .minLimit = 1, .sheddableRatio = 0.5}};
+    std::vector<sd::ConcurrencyLimiter::Permit> permits;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        permits.push_back(limiter.tryAcquire(sd::RequestPriority::Sheddable));
+        EXPECT_TRUE(permits.back());
+    }
+    EXPECT_FALSE(limiter.tryAcquire(sd::RequestPriority::Sheddable));
+
+    for (int i = 0; i < 5; ++i)
+    {
+        permits.push_back(limiter.tryAcquire(sd::RequestPriority::Normal));
+        EXPECT_TRUE(permits.back());
+    }
+    EXPECT_FALSE(limiter.tryAcquire(sd::RequestPriority::Normal));
+    EXPECT_TRUE(limiter.tryAcquire(sd::RequestPriority::Critical));
+    EXPECT_EQ(limiter.getInFlight(), 10);
+
+    permits.clear();
+    EXPECT_EQ(limiter.getInFlight(), 0);
+}
+
+TEST(ConcurrencyLimiterTest, ShouldGrowWhenFast)
+{
+    sd::ConcurrencyLimiter limiter{{.initialLimit = 4, .minLimit = 1}};
+
+    for (int i = 0; i < 4; ++i)
+    {
+        limiter.tryAcquire(sd::RequestPriority::Normal);
+    }
+
+    EXPECT_EQ(limiter.getLimit(), 5);
+}
+
+TEST(ConcurrencyLimiterTest, ShouldShrinkOnceWhenSlow)
+{
+    sd::ConcurrencyLimiter limiter{{.initialLimit = 100, .latencyTarget = std::chrono::seconds{10}}};
+    std::vector<sd::ConcurrencyLimiter::Permit> permits;
+    auto arrival = sd::ConcurrencyLimiter::Clock::now();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        permits.push_back(limiter.tryAcquire(sd::RequestPriority::Normal, arrival));
+    }
+    for (auto &permit : permits)
+    {
+        permit.finish(arrival + std::chrono::seconds{11});
+    }
+
+    EXPECT_EQ(limiter.getLimit(), 90);
+    EXPECT_EQ(limiter.getInFlight(), 0);
+}
+
+TEST(ConcurrencyLimiterTest, ShouldShedRequestsQueuedLongerThanTarget)
+{
+    sd::ConcurrencyLimiter limiter{{.initialLimit = 100, .latencyTarget = std::chrono::milliseconds{10}}};
+    auto arrival = sd::ConcurrencyLimiter::Clock::now() - std::chrono::milliseconds{50};
+
+    EXPECT_FALSE(limiter.tryAcquire(sd::RequestPriority::Normal, arrival));
+    EXPECT_TRUE(limiter.tryAcquire(sd::RequestPriority::Critical, arrival));
+    EXPECT_EQ(limiter.getLimit(), 90);
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "Common/Utils.hpp"
+
+TEST(ConvertTest, ShouldConvertNumbers)
+{
+    int i = 0;
+    double d = 0;
+    float f = 0;
+
+    EXPECT_TRUE(sd::utils::tryConvert("-123", i));
+    EXPECT_EQ(i, -123);
+    EXPECT_TRUE(sd::utils::tryConvert("2.5", d));
+    EXPECT_DOUBLE_EQ(d, 2.5);
+    EXPECT_TRUE(sd::utils::tryConvert("0.25", f));
+    EXPECT_FLOAT_EQ(f, 0.25f);
+}
+
+TEST(ConvertTest, ShouldRejectMalformedNumbers)
+{
+    int i = 0;
+    double d = 0;
+
+    EXPECT_FALSE(sd::utils::tryConvert("", i));
+    EXPECT_FALSE(sd::utils::tryConvert("12abc", i));
+    EXPECT_FALSE(sd::utils::tryConvert("1.5", i));
+    EXPECT_FALSE(sd::utils::tryConvert("99999999999", i));
+    EXPECT_FALSE(sd::utils::tryConvert("abc", d));
+    EXPECT_THROW(sd::utils::convert<int>("abc"), std::bad_cast);
+}
+
+TEST(ConvertTest, ShouldConvertBool)
+{
+    bool b = false;
+
+    EXPECT_TRUE(sd::utils::tryConvert("TRUE", b));
+    EXPECT_TRUE(b);
+    EXPECT_TRUE(sd::utils::tryConvert("False", b));
+    EXPECT_FALSE(b);
+    EXPECT_TRUE(sd::utils::tryConvert("1", b));
+    EXPECT_TRUE(b);
+    EXPECT_FALSE(sd::utils::tryConvert("yes", b));
+}
+
+TEST(ConvertTest, ShouldConvertString)
+{
+    std::string s;
+
+    EXPECT_TRUE(sd::utils::tryConvert("value", s));
+    EXPECT_EQ(s, "value");
+    EXPECT_EQ(sd::utils::convert<std::string>("other"), "other");
+}
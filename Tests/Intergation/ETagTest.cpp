@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "Common/XxHash64.hpp"
+#include "Http/BufferChain.hpp"
+#include "Http/ETag.hpp"
+
+TEST(ETagTest, ShouldMatchReferenceHashes)
+{
+    EXPECT_EQ(sd::utils::XxHash64::hash(""), 0xEF46DB3751D8E999ull);
+    EXPECT_EQ(sd::utils::XxHash64::hash("abc"), 0x44BC2CF5AD770999ull);
+    EXPECT_EQ(sd::utils::XxHash64::hash("Nobody inspects the spammish repetition"), 0xFBCEA83C8A378BF1ull);
+}
+
+TEST(ETagTest, ShouldHashSegmentsAsWhole)
+{
+    std::string data(1000, 'x');
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<char>(i * 7);
+    }
+    sd::BufferChain chain;
+    chain.append(data.substr(0, 3));
+    chain.append(data.substr(3, 40));
+    chain.appendStatic(std::string_view{data}.substr(43));
+
+    EXPECT_EQ(sd::ETag::fromBody(chain), sd::ETag::compute(data));
+    EXPECT_EQ(sd::ETag::compute(""), "\"ef46db3751d8e999\"");
+}
+
+TEST(ETagTest, ShouldMatchIfNoneMatch)
+{
+    EXPECT_TRUE(sd::ETag::matches("\"a\"", "\"a\""));
+    EXPECT_TRUE(sd::ETag::matches("\"b\", W/\"a\"", "\"a\""));
+    EXPECT_TRUE(sd::ETag::matches("*", "\"a\""));
+    EXPECT_FALSE(sd::ETag::matches("\"b\",\"c\"", "\"a\""));
+    EXPECT_FALSE(sd::ETag::matches("", "\"a\""));
+}
@@ -0,0 +1,49 @@
+#include <array>
+#include <functional>
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "Common/InlineFunction.hpp"
+
+TEST(InlineFunctionTest, ShouldInvokeInlineCallable)
+{
+    sd::InlineFunction<int(int)> fcn = [](int x) { return x + 1; };
+
+    EXPECT_TRUE(fcn);
+    EXPECT_EQ(fcn(1), 2);
+}
+
+TEST(InlineFunctionTest, ShouldStoreBigCallableOnHeap)
+{
+    auto counter = std::make_shared<int>(5);
+    std::array<char, 128> padding{};
+    sd::InlineFunction<int()> fcn = [counter, padding] { return *counter + static_cast<int>(padding.size()); };
+
+    auto copy = fcn;
+    auto moved = std::move(fcn);
+
+    EXPECT_FALSE(fcn);
+    EXPECT_EQ(copy(), 133);
+    EXPECT_EQ(moved(), 133);
+    EXPECT_EQ(counter.use_count(), 3);
+}
+
+TEST(InlineFunctionTest, ShouldReleaseCallable)
+{
+    auto counter = std::make_shared<int>(5);
+    {
+        sd::InlineFunction<int()> fcn = [counter] { return *counter; };
+        auto copy = fcn;
+        fcn = nullptr;
+        EXPECT_EQ(copy(), 5);
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(InlineFunctionTest, ShouldThrowWhenEmpty)
+{
+    sd::InlineFunction<void()> fcn;
+
+    EXPECT_FALSE(fcn);
+    EXPECT_THROW(fcn(), std::bad_function_call);
+}
@@ -0,0 +1,70 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <string>
+
+#include "SevenBitRest.hpp"
+
+using namespace std::string_literals;
+
+namespace
+{
+    template <int Id> struct CountingMiddleware final : sd::IMiddleware
+    {
+        static inline std::atomic<int> created = 0;
+
+        CountingMiddleware() { ++created; }
+
+        void next(sd::IContext &, sd::INextCallback &callback) final { callback.next(); }
+    };
+} // namespace
+
+TEST(MiddlewareLifetimeTest, ShouldCreateSingletonOnlyForSingletonLifetime)
+{
+    sd::MiddlewareCreator<CountingMiddleware<0>> scoped;
+    sd::MiddlewareCreator<CountingMiddleware<1>, sd::MiddlewareLifetime::Singleton> singleton;
+
+    EXPECT_EQ(scoped.getLifetime(), sd::MiddlewareLifetime::Scoped);
+    EXPECT_EQ(scoped.createSingleton(), nullptr);
+    EXPECT_EQ(singleton.getLifetime(), sd::MiddlewareLifetime::Singleton);
+    EXPECT_NE(singleton.createSingleton(), nullptr);
+}
+
+TEST(MiddlewareLifetimeTest, ShouldCreateScopedMiddlewarePerRequest)
+{
+    using Scoped = CountingMiddleware<2>;
+    using Singleton = CountingMiddleware<3>;
+    auto app = sd::WebApplicationBuilder{}.build();
+    sd::TestServer server{app};
+    app.use<Scoped>();
+    app.useSingleton<Singleton>();
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(server.get("/hello").statusCode, 200);
+    }
+
+    EXPECT_EQ(Scoped::created, 3);
+    EXPECT_EQ(Singleton::created, 1);
+}
+
+TEST(MiddlewareLifetimeTest, ShouldCopyLambdaPerRequestUnlessSingleton)
+{
+    auto app = sd::WebApplicationBuilder{}.build();
+    sd::TestServer server{app};
+    app.use([calls = 0](sd::IContext &ctx, sd::INextCallback &next) mutable {
+        next();
+        ctx.getResponse().getHeaders().set("X-Scoped", std::to_string(++calls));
+    });
+    app.useSingleton([calls = 0](sd::IContext &ctx, sd::INextCallback &next) mutable {
+        next();
+        ctx.getResponse().getHeaders().set("X-Singleton", std::to_string(++calls));
+    });
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    EXPECT_EQ(server.get("/hello").getHeader("X-Scoped"), "1");
+    auto response = server.get("/hello");
+
+    EXPECT_EQ(response.getHeader("X-Scoped"), "1");
+    EXPECT_EQ(response.getHeader("X-Singleton"), "2");
+}
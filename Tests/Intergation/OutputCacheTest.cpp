@@ -0,0 +1,103 @@
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include "Engine/OutputCachePolicy.hpp"
+#include "Http/ResponseSnapshot.hpp"
+#include "Middlewares/OutputCache.hpp"
+
+namespace
+{
+    sd::OutputCache::Entry makeEntry(const sd::OutputCachePolicy::Ptr &policy, std::string body)
+    {
+        auto response = std::make_shared<sd::ResponseSnapshot>();
+        response->body = std::make_shared<const std::string>(std::move(body));
+        return {response, policy, sd::OutputCache::Clock::now() + policy->duration};
+    }
+
+    sd::OutputCachePolicy::Ptr makePolicy(sd::OutputCachePolicy policy = {})
+    {
+        return std::make_shared<const sd::OutputCachePolicy>(std::move(policy));
+    }
+} // namespace
+
+TEST(OutputCacheTest, ShouldReturnStoredEntry)
+{
+    sd::OutputCache cache;
+    auto policy = makePolicy();
+
+    cache.set("key", makeEntry(policy, "body"));
+
+    auto entry = cache.get("key");
+    ASSERT_TRUE(entry);
+    EXPECT_EQ(*entry->response->body, "body");
+    EXPECT_EQ(entry->policy, policy);
+    EXPECT_FALSE(cache.get("other"));
+}
+
+TEST(OutputCacheTest, ShouldSkipExpiredEntry)
+{
+    sd::OutputCache cache;
+    auto policy = makePolicy({.duration = std::chrono::milliseconds{0}});
+
+    cache.set("key", makeEntry(policy, "body"));
+
+    EXPECT_FALSE(cache.get("key"));
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(OutputCacheTest, ShouldEvictLeastRecentlyUsed)
+{
+    // each of 16 shards fits two entries, "0" is kept by reading it after every insert
+    sd::OutputCache cache{{.maxSize = 16 * 1024}};
+    auto policy = makePolicy();
+    std::string body(400, 'x');
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        cache.set(std::to_string(i), makeEntry(policy, body));
+        cache.get("0");
+    }
+
+    EXPECT_TRUE(cache.get("0"));
+    EXPECT_FALSE(cache.get("1"));
+    EXPECT_LE(cache.size(), 16 * 1024);
+}
+
+TEST(OutputCacheTest, ShouldNotStoreTooBigEntry)
+{
+    sd::OutputCache cache{{.maxSize = 16 * 1024}};
+    auto policy = makePolicy();
+
+    cache.set("key", makeEntry(policy, std::string(2048, 'x')));
+
+    EXPECT_FALSE(cache.get("key"));
+}
+
+TEST(OutputCacheTest, ShouldEvictByTag)
+{
+    sd::OutputCache cache;
+    auto products = makePolicy({.tags = {"products"}});
+    auto orders = makePolicy({.tags = {"orders"}});
+
+    cache.set("a", makeEntry(products, "a"));
+    cache.set("b", makeEntry(products, "b"));
+    cache.set("c", makeEntry(orders, "c"));
+
+    EXPECT_EQ(cache.evictByTag("products"), 2);
+    EXPECT_FALSE(cache.get("a"));
+    EXPECT_FALSE(cache.get("b"));
+    EXPECT_TRUE(cache.get("c"));
+}
+
+TEST(OutputCacheTest, ShouldKeepPolicyAliveWhileEntriesUseIt)
+{
+    sd::OutputCache cache;
+    {
+        auto policy = makePolicy({.tags = {"products"}});
+        cache.set("a", makeEntry(policy, "a"));
+    }
+
+    EXPECT_EQ(cache.evictByTag("products"), 1);
+}
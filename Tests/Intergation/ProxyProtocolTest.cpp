@@ -0,0 +1,276 @@
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/http/read.hpp>
+#include <boost/beast/http/string_body.hpp>
+#include <boost/system/system_error.hpp>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "Common/ServerSettings.hpp"
+#include "Common/Task.hpp"
+#include "Engine/BoostBeastServer.hpp"
+#include "Engine/ConnectionInfo.hpp"
+#include "Engine/ProxyProtocol.hpp"
+#include "Engine/Url.hpp"
+#include "Log/Logger.hpp"
+
+namespace
+{
+    using Status = sd::ProxyProtocol::Status;
+    using tcp = boost::asio::ip::tcp;
+
+    // Real server listening with PROXY protocol on loopback, responds with client address it has seen
+    class ProxyServer
+    {
+      private:
+        sd::Logger _logger{{}, nullptr};
+        sd::BoostBeastServer _server{_logger, respondWithAddress, sd::ServerSettings{.threadsNumber = 1}};
+        uint16_t _port = getFreePort();
+        std::thread _thread;
+
+      public:
+        ProxyServer()
+        {
+            _thread = std::thread{[this] {
+                _server.start({sd::Url{"http://127.0.0.1:" + std::to_string(_port) + "?proxyProtocol=true"}});
+            }};
+        }
+
+        // every test connected first, so server is already running and stop is not lost
+        ~ProxyServer()
+        {
+            _server.stop();
+            _thread.join();
+        }
+
+        // sends raw data and reads response, empty when server closed connection without response
+        std::string send(std::string_view data)
+        {
+            boost::asio::io_context ioc;
+            tcp::socket socket{ioc};
+            connect(socket);
+            boost::asio::write(socket, boost::asio::buffer(data));
+
+            boost::beast::flat_buffer buffer;
+            boost::beast::http::response<boost::beast::http::string_body> response;
+            boost::beast::error_code ec;
+            boost::beast::http::read(socket, buffer, response, ec);
+            return ec ? "" : response.body();
+        }
+
+      private:
+        void connect(tcp::socket &socket)
+        {
+            tcp::endpoint endpoint{boost::asio::ip::address_v4::loopback(), _port};
+            boost::beast::error_code ec;
+            // listener starts on server thread
+            for (int i = 0; i < 500; ++i)
+            {
+                socket.connect(endpoint, ec);
+                if (!ec)
+                {
+                    return;
+                }
+                socket.close();
+                std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            }
+            throw boost::system::system_error{ec};
+        }
+
+        static uint16_t getFreePort()
+        {
+            boost::asio::io_context ioc;
+            tcp::acceptor acceptor{ioc, tcp::endpoint{boost::asio::ip::address_v4::loopback(), 0}};
+            return acceptor.local_endpoint().port();
+        }
+
+        static sd::Task<sd::NativeResponse> respondWithAddress(sd::NativeRequest &request,
+                                                               const sd::ConnectionInfo &info)
+        {
+            sd::NativeResponse response{boost::beast::http::status::ok, request.version()};
+            response.body() = sd::BufferChain{info.remoteAddress + ":" + std::to_string(info.remotePort)};
+            response.keep_alive(false);
+            response.prepare_payload();
+            co_return response;
+        }
+    };
+
+    std::string v2Header(unsigned char command, unsigned char family, std::string addresses)
+    {
+        std::string header{"\r\n\r\n\0\r\nQUIT\n", 12};
+        header.push_back(static_cast<char>(0x20 | command));
+        header.push_back(static_cast<char>(family));
+        header.push_back(static_cast<char>(addresses.size() >> 8));
+        header.push_back(static_cast<char>(addresses.size() & 0xFF));
+        return header + addresses;
+    }
+} // namespace
+
+class ProxyProtocolTest : public ::testing::Test
+{
+  protected:
+    static void TearUpTestSuite() {}
+
+    sd::ConnectionInfo info{.remoteAddress = "10.0.0.1", .remotePort = 1000};
+
+    ProxyProtocolTest() {}
+
+    void SetUp() override {}
+
+    void TearDown() override {}
+
+    ~ProxyProtocolTest() {}
+
+    static void TearDownTestSuite() {}
+};
+
+TEST_F(ProxyProtocolTest, V1Tcp4)
+{
+    std::string data = "PROXY TCP4 192.168.0.1 192.168.0.11 56324 443\r\nGET / HTTP/1.1\r\n";
+
+    auto result = sd::ProxyProtocol::parse(data, info);
+
+    EXPECT_EQ(result.status, Status::Complete);
+    EXPECT_EQ(data.substr(result.headerSize), "GET / HTTP/1.1\r\n");
+    EXPECT_EQ(info.remoteAddress, "192.168.0.1");
+    EXPECT_EQ(info.remotePort, 56324);
+    EXPECT_TRUE(info.fromProxyProtocol);
+}
+
+TEST_F(ProxyProtocolTest, V1Tcp6)
+{
+    auto result = sd::ProxyProtocol::parse("PROXY TCP6 2001:db8::1 2001:db8::2 4000 80\r\n", info);
+
+    EXPECT_EQ(result.status, Status::Complete);
+    EXPECT_EQ(info.remoteAddress, "2001:db8::1");
+    EXPECT_EQ(info.remotePort, 4000);
+}
+
+TEST_F(ProxyProtocolTest, V1Unknown)
+{
+    auto result = sd::ProxyProtocol::parse("PROXY UNKNOWN\r\n", info);
+
+    EXPECT_EQ(result.status, Status::Complete);
+    EXPECT_EQ(result.headerSize, 15);
+    EXPECT_EQ(info.remoteAddress, "10.0.0.1");
+    EXPECT_FALSE(info.fromProxyProtocol);
+}
+
+TEST_F(ProxyProtocolTest, V1Partial)
+{
+    EXPECT_EQ(sd::ProxyProtocol::parse("PRO", info).status, Status::NeedMore);
+    EXPECT_EQ(sd::ProxyProtocol::parse("PROXY TCP4 192.168.0.1", info).status, Status::NeedMore);
+}
+
+TEST_F(ProxyProtocolTest, V1Invalid)
+{
+    EXPECT_EQ(sd::ProxyProtocol::parse("GET / HTTP/1.1\r\n", info).status, Status::Invalid);
+    EXPECT_EQ(sd::ProxyProtocol::parse("PROXY TCP4 bad 192.168.0.11 1 2\r\n", info).status, Status::Invalid);
+    EXPECT_EQ(sd::ProxyProtocol::parse("PROXY TCP4 192.168.0.1 192.168.0.11 port 2\r\n", info).status,
+              Status::Invalid);
+    EXPECT_EQ(sd::ProxyProtocol::parse("PROXY TCP6 192.168.0.1 192.168.0.11 1 2\r\n", info).status,
+              Status::Invalid);
+    EXPECT_EQ(sd::ProxyProtocol::parse("PROXY " + std::string(200, 'x'), info).status, Status::Invalid);
+}
+
+TEST_F(ProxyProtocolTest, V1InvalidDestination)
+{
+    EXPECT_EQ(sd::ProxyProtocol::parse("PROXY TCP4 1.2.3.4 garbage 80 x\r\n", info).status, Status::Invalid);
+    EXPECT_EQ(sd::ProxyProtocol::parse("PROXY TCP4 1.2.3.4 2001:db8::2 80 443\r\n", info).status, Status::Invalid);
+    EXPECT_EQ(sd::ProxyProtocol::parse("PROXY TCP4 1.2.3.4 5.6.7.8 80 x\r\n", info).status, Status::Invalid);
+    EXPECT_EQ(sd::ProxyProtocol::parse("PROXY TCP4 1.2.3.4 5.6.7.8 80 70000\r\n", info).status, Status::Invalid);
+    EXPECT_FALSE(info.fromProxyProtocol);
+}
+
+TEST_F(ProxyProtocolTest, V2Tcp4)
+{
+    std::string addresses = {'\xC0', '\xA8', '\x00', '\x01', '\xC0', '\xA8', '\x00', '\x0B',
+                             '\xDC', '\x04', '\x01', '\xBB'};
+    auto data = v2Header(1, 0x11, addresses) + "rest";
+
+    auto result = sd::ProxyProtocol::parse(data, info);
+
+    EXPECT_EQ(result.status, Status::Complete);
+    EXPECT_EQ(data.substr(result.headerSize), "rest");
+    EXPECT_EQ(info.remoteAddress, "192.168.0.1");
+    EXPECT_EQ(info.remotePort, 56324);
+    EXPECT_TRUE(info.fromProxyProtocol);
+}
+
+TEST_F(ProxyProtocolTest, V2Tcp6)
+{
+    std::string addresses(36, '\0');
+    addresses[0] = '\x20';
+    addresses[1] = '\x01';
+    addresses[15] = '\x01';
+    addresses[32] = '\x0F';
+    addresses[33] = '\xA0';
+
+    auto result = sd::ProxyProtocol::parse(v2Header(1, 0x21, addresses), info);
+
+    EXPECT_EQ(result.status, Status::Complete);
+    EXPECT_EQ(info.remoteAddress, "2001::1");
+    EXPECT_EQ(info.remotePort, 4000);
+}
+
+TEST_F(ProxyProtocolTest, V2Local)
+{
+    auto data = v2Header(0, 0x00, "");
+
+    auto result = sd::ProxyProtocol::parse(data, info);
+
+    EXPECT_EQ(result.status, Status::Complete);
+    EXPECT_EQ(result.headerSize, 16);
+    EXPECT_FALSE(info.fromProxyProtocol);
+}
+
+TEST_F(ProxyProtocolTest, V2Partial)
+{
+    std::string addresses(12, '\x01');
+    auto data = v2Header(1, 0x11, addresses);
+
+    EXPECT_EQ(sd::ProxyProtocol::parse(data.substr(0, 5), info).status, Status::NeedMore);
+    EXPECT_EQ(sd::ProxyProtocol::parse(data.substr(0, 20), info).status, Status::NeedMore);
+}
+
+TEST_F(ProxyProtocolTest, V2Invalid)
+{
+    auto data = v2Header(1, 0x11, std::string(4, '\x01'));
+
+    EXPECT_EQ(sd::ProxyProtocol::parse(data, info).status, Status::Invalid);
+    EXPECT_EQ(sd::ProxyProtocol::parse(std::string{"\r\n\r\nxx"}, info).status, Status::Invalid);
+}
+
+TEST_F(ProxyProtocolTest, ShouldReadClientAddressOnAcceptedConnection)
+{
+    ProxyServer server;
+
+    auto body = server.send("PROXY TCP4 192.168.0.1 192.168.0.11 56324 80\r\n"
+                            "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n");
+
+    EXPECT_EQ(body, "192.168.0.1:56324");
+}
+
+TEST_F(ProxyProtocolTest, ShouldReadClientAddressFromV2HeaderOnAcceptedConnection)
+{
+    ProxyServer server;
+    // 10.1.2.3:8080 -> 10.0.0.2:80
+    std::string addresses = {'\x0A', '\x01', '\x02', '\x03', '\x0A', '\x00', '\x00', '\x02',
+                             '\x1F', '\x90', '\x00', '\x50'};
+
+    auto body = server.send(v2Header(1, 0x11, addresses) + "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n");
+
+    EXPECT_EQ(body, "10.1.2.3:8080");
+}
+
+TEST_F(ProxyProtocolTest, ShouldCloseAcceptedConnectionWithoutHeader)
+{
+    ProxyServer server;
+
+    EXPECT_EQ(server.send("GET / HTTP/1.1\r\nHost: localhost\r\n\r\n"), "");
+}
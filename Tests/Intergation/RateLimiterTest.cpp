@@ -0,0 +1,137 @@
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Middlewares/RateLimiter.hpp"
+
+TEST(RateLimiterTest, ShouldAllowBurstThenReject)
+{
+    sd::RateLimiter limiter{{.permits = 5, .window = std::chrono::hours{1}}};
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(limiter.acquire("client").count(), 0);
+    }
+
+    auto wait = limiter.acquire("client");
+    EXPECT_GT(wait, std::chrono::minutes{11});
+    EXPECT_LE(wait, std::chrono::minutes{12});
+    EXPECT_EQ(limiter.acquire("other").count(), 0);
+}
+
+TEST(RateLimiterTest, ShouldRefill)
+{
+    sd::RateLimiter limiter{{.permits = 2, .window = std::chrono::milliseconds{20}}};
+    auto now = sd::RateLimiter::Clock::now();
+
+    EXPECT_EQ(limiter.acquire("client", now).count(), 0);
+    EXPECT_EQ(limiter.acquire("client", now).count(), 0);
+    EXPECT_EQ(limiter.acquire("client", now), std::chrono::milliseconds{10});
+    EXPECT_GT(limiter.acquire("client", now + std::chrono::milliseconds{9}).count(), 0);
+
+    EXPECT_EQ(limiter.acquire("client", now + std::chrono::milliseconds{10}).count(), 0);
+}
+
+TEST(RateLimiterTest, ShouldRejectWindowShorterThanPermits)
+{
+    EXPECT_THROW(sd::RateLimiter({.permits = 2'000'000, .window = std::chrono::milliseconds{1}}), std::runtime_error);
+}
+
+TEST(RateLimiterTest, ShouldRemoveRefilledBuckets)
+{
+    sd::RateLimiter limiter{{.permits = 1, .window = std::chrono::milliseconds{1}}};
+
+    auto now = sd::RateLimiter::Clock::now();
+
+    limiter.acquire("a", now);
+    limiter.acquire("b", now);
+    EXPECT_EQ(limiter.size(), 2);
+
+    limiter.cleanup(now);
+    EXPECT_EQ(limiter.size(), 2);
+
+    limiter.cleanup(now + std::chrono::milliseconds{1});
+
+    EXPECT_EQ(limiter.size(), 0);
+}
+
+TEST(RateLimiterTest, ShouldRemoveRefilledBucketsOnTimer)
+{
+    sd::RateLimiter limiter{
+        {.permits = 1, .window = std::chrono::milliseconds{1}, .cleanupInterval = std::chrono::milliseconds{5}}};
+
+    limiter.acquire("a");
+    EXPECT_EQ(limiter.size(), 1);
+
+    for (int i = 0; i < 200 && limiter.size(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+
+    EXPECT_EQ(limiter.size(), 0);
+}
+
+TEST(RateLimiterTest, ShouldRejectNonPositiveCleanupInterval)
+{
+    EXPECT_THROW(sd::RateLimiter({.cleanupInterval = std::chrono::milliseconds{0}}), std::runtime_error);
+}
+
+TEST(RateLimiterTest, ShouldCapBuckets)
+{
+    sd::RateLimiter limiter{{.permits = 1, .window = std::chrono::hours{1}, .maxBuckets = 16}};
+
+    auto allowed = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        allowed += limiter.acquire("client" + std::to_string(i)).count() == 0 ? 1 : 0;
+    }
+
+    EXPECT_LE(limiter.size(), 16);
+    EXPECT_LE(allowed, 17);
+    EXPECT_GT(limiter.acquire("client0").count(), 0);
+}
+
+TEST(RateLimiterTest, ShouldNotCreateBucketInFullShard)
+{
+    sd::RateLimiter limiter{{.permits = 1, .window = std::chrono::hours{1}, .maxBuckets = 1}};
+
+    auto missing = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        missing += limiter.tryAcquire("client" + std::to_string(i)) ? 0 : 1;
+    }
+
+    EXPECT_GT(missing, 0);
+    EXPECT_LE(limiter.size(), 16);
+}
+
+TEST(RateLimiterTest, ShouldRejectZeroMaxBuckets)
+{
+    EXPECT_THROW(sd::RateLimiter({.maxBuckets = 0}), std::runtime_error);
+}
+
+TEST(RateLimiterTest, ShouldNotExceedPermitsConcurrently)
+{
+    sd::RateLimiter limiter{{.permits = 1000, .window = std::chrono::hours{1}}};
+    std::atomic<int> allowed = 0;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 500; ++i)
+            {
+                allowed += limiter.acquire("client").count() == 0 ? 1 : 0;
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(allowed, 1000);
+}
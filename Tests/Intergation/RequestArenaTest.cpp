@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "Engine/RequestArena.hpp"
+
+namespace
+{
+    // thread buffer is recycled per thread, each test starts with empty one
+    template <class Test> void runOnNewThread(Test test) { std::thread{test}.join(); }
+} // namespace
+
+TEST(RequestArenaTest, ShouldRecycleBufferBetweenRequests)
+{
+    runOnNewThread([] {
+        void *first = nullptr;
+        {
+            sd::RequestArena arena;
+            first = arena.allocate(64);
+        }
+        sd::RequestArena arena;
+
+        EXPECT_EQ(arena.allocate(64), first);
+    });
+}
+
+TEST(RequestArenaTest, ShouldGrowBufferAfterOverflow)
+{
+    runOnNewThread([] {
+        sd::ArenaStatisticsCollector statistics;
+        {
+            sd::RequestArena arena{&statistics};
+            EXPECT_NE(arena.allocate(sd::RequestArena::InitialBufferSize + 1), nullptr);
+        }
+        {
+            sd::RequestArena arena{&statistics};
+            EXPECT_NE(arena.allocate(sd::RequestArena::InitialBufferSize + 1), nullptr);
+        }
+
+        EXPECT_EQ(statistics.get().requests, 2);
+        EXPECT_EQ(statistics.get().overflows, 1);
+    });
+}
+
+TEST(RequestArenaTest, ShouldCountOverflowCausedByAlignment)
+{
+    runOnNewThread([] {
+        sd::ArenaStatisticsCollector statistics;
+        for (int i = 0; i < 2; ++i)
+        {
+            sd::RequestArena arena{&statistics};
+            EXPECT_NE(arena.allocate(1, 1), nullptr);
+            EXPECT_NE(arena.allocate(sd::RequestArena::InitialBufferSize - 1, 64), nullptr);
+            EXPECT_EQ(arena.getAllocatedBytes(), sd::RequestArena::InitialBufferSize);
+        }
+
+        EXPECT_EQ(statistics.get().overflows, 1);
+    });
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "Engine/ConnectionInfo.hpp"
+#include "Engine/RequestArena.hpp"
+#include "Http/Request.hpp"
+#include "SevenBitRest.hpp"
+
+TEST(RequestBodyTest, ShouldTakeBodyWithoutCopying)
+{
+    sd::NativeRequest native{boost::beast::http::verb::post, "/items", 11};
+    native.body() = std::string(1024, 'x');
+    auto data = native.body().data();
+    sd::ConnectionInfo info;
+    sd::RequestArena arena;
+    sd::Request request{native, info, arena};
+
+    EXPECT_EQ(request.getBody().data(), data);
+
+    auto body = request.takeBody();
+
+    EXPECT_EQ(body.data(), data);
+    EXPECT_EQ(body.size(), 1024);
+    EXPECT_TRUE(request.getBody().empty());
+}
+
+TEST(RequestBodyTest, ShouldBindTakenBody)
+{
+    auto app = sd::WebApplicationBuilder{}.build();
+    sd::TestServer server{app};
+    app.mapPost("/echo", [](sd::FromBody<std::string> body) { return std::move(*body); });
+
+    auto response = server.post("/echo", "Hello, world!", "text/plain");
+
+    EXPECT_EQ(response.statusCode, 200);
+    EXPECT_EQ(response.body, "Hello, world!");
+}
@@ -0,0 +1,231 @@
+#include <coroutine>
+#include <exception>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "Common/InlineExecutor.hpp"
+#include "Common/Task.hpp"
+#include "DI/ServiceProvider.hpp"
+#include "Engine/ConnectionInfo.hpp"
+#include "Engine/Context.hpp"
+#include "Engine/Endpoint.hpp"
+#include "Engine/RequestArena.hpp"
+#include "Http/DefaultHeaders.hpp"
+
+namespace
+{
+    // Completes when test opens it, like response of slow backend
+    struct Gate
+    {
+        std::coroutine_handle<> waiter;
+        bool opened = false;
+
+        bool await_ready() const { return opened; }
+
+        void await_suspend(std::coroutine_handle<> handle) { waiter = handle; }
+
+        void await_resume() const {}
+
+        void open()
+        {
+            opened = true;
+            if (auto handle = std::exchange(waiter, nullptr))
+            {
+                handle.resume();
+            }
+        }
+    };
+
+    struct Call
+    {
+        sd::NativeRequest native{boost::beast::http::verb::get, "/report?year=2024", 11};
+        sd::ConnectionInfo info;
+        sd::DefaultHeaders defaultHeaders;
+        sd::RequestArena arena;
+        sd::Context ctx;
+        bool done = false;
+
+        Call(sd::ServiceProvider &services, sd::IExecutor &executor)
+            : ctx{native, info, defaultHeaders, arena, services, executor}
+        {
+        }
+
+        void run(sd::Endpoint &endpoint)
+        {
+            endpoint.executeAction(ctx);
+            if (auto continuation = ctx.takeContinuation())
+            {
+                sd::startTask(std::move(continuation), [this](std::exception_ptr) { done = true; });
+                return;
+            }
+            done = true;
+        }
+
+        std::string getBody() { return ctx.takeNativeResponse().body().toString(); }
+    };
+
+    class RequestCoalescerTest : public ::testing::Test
+    {
+      protected:
+        sd::ServiceCollection collection;
+        sd::ServiceContainer singletons;
+        sd::ServiceProvider services{collection, singletons};
+        sd::InlineExecutor executor;
+        Gate gate;
+        int calls = 0;
+        bool fail = false;
+
+        sd::Task<> respondAfterGate(sd::IContext &ctx)
+        {
+            co_await gate;
+            if (std::exchange(fail, false))
+            {
+                throw std::runtime_error("backend failed");
+            }
+            ctx.getResponse().setBody("report " + std::to_string(calls));
+        }
+
+        std::unique_ptr<sd::Endpoint> createEndpoint(sd::CoalescingOptions options = {})
+        {
+            auto endpoint = std::make_unique<sd::Endpoint>(sd::HttpMethod::Get, "/report", [this](sd::IContext &ctx) {
+                ++calls;
+                ctx.setContinuation(respondAfterGate(ctx));
+            });
+            endpoint->useCoalescing(std::move(options));
+            endpoint->compile();
+            return endpoint;
+        }
+
+        sd::Task<> respondToCallerAfterGate(sd::IContext &ctx)
+        {
+            co_await gate;
+            auto caller = ctx.getRequest().getHeaders().get("Authorization").value_or("anonymous");
+            ctx.getResponse().setBody("report for " + std::string{caller});
+        }
+
+        std::unique_ptr<sd::Endpoint> createCallerEndpoint(sd::CoalescingOptions options = {})
+        {
+            auto endpoint = std::make_unique<sd::Endpoint>(sd::HttpMethod::Get, "/report", [this](sd::IContext &ctx) {
+                ++calls;
+                ctx.setContinuation(respondToCallerAfterGate(ctx));
+            });
+            endpoint->useCoalescing(std::move(options));
+            endpoint->compile();
+            return endpoint;
+        }
+    };
+} // namespace
+
+TEST_F(RequestCoalescerTest, ShouldShareAsyncLeaderResponseWithFollower)
+{
+    auto endpoint = createEndpoint();
+    Call leader{services, executor}, follower{services, executor};
+
+    leader.run(*endpoint);
+    follower.run(*endpoint);
+    EXPECT_FALSE(leader.done);
+    EXPECT_FALSE(follower.done);
+
+    gate.open();
+
+    EXPECT_TRUE(leader.done);
+    EXPECT_TRUE(follower.done);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(leader.getBody(), "report 1");
+    EXPECT_EQ(follower.getBody(), "report 1");
+}
+
+TEST_F(RequestCoalescerTest, ShouldRunActionInFollowerWhenLeaderFailed)
+{
+    auto endpoint = createEndpoint();
+    Call leader{services, executor}, follower{services, executor};
+    fail = true;
+
+    leader.run(*endpoint);
+    follower.run(*endpoint);
+    gate.open();
+
+    EXPECT_TRUE(leader.done);
+    EXPECT_TRUE(follower.done);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(follower.getBody(), "report 2");
+}
+
+TEST_F(RequestCoalescerTest, ShouldStartNewFlightAfterLeaderFinished)
+{
+    auto endpoint = createEndpoint();
+    Call first{services, executor}, second{services, executor};
+
+    first.run(*endpoint);
+    gate.open();
+    second.run(*endpoint);
+
+    EXPECT_TRUE(second.done);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(second.getBody(), "report 2");
+}
+
+TEST_F(RequestCoalescerTest, ShouldRejectCoalescingOfUnsafeMethods)
+{
+    sd::Endpoint endpoint{sd::HttpMethod::Post, "/report", [](sd::IContext &) {}};
+
+    EXPECT_THROW(endpoint.useCoalescing(), std::runtime_error);
+}
+
+TEST_F(RequestCoalescerTest, ShouldNotShareResponseBetweenDifferentAuthorizations)
+{
+    auto endpoint = createCallerEndpoint();
+    Call first{services, executor}, second{services, executor};
+    first.native.set(boost::beast::http::field::authorization, "Bearer first");
+    second.native.set(boost::beast::http::field::authorization, "Bearer second");
+
+    first.run(*endpoint);
+    second.run(*endpoint);
+    gate.open();
+
+    EXPECT_TRUE(first.done);
+    EXPECT_TRUE(second.done);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(first.getBody(), "report for Bearer first");
+    EXPECT_EQ(second.getBody(), "report for Bearer second");
+}
+
+TEST_F(RequestCoalescerTest, ShouldShareResponseBetweenSameAuthorizationsWhenVaryingByIt)
+{
+    auto endpoint = createCallerEndpoint({.varyByHeaders = {"Authorization"}});
+    Call first{services, executor}, second{services, executor}, other{services, executor};
+    first.native.set(boost::beast::http::field::authorization, "Bearer first");
+    second.native.set(boost::beast::http::field::authorization, "Bearer first");
+    other.native.set(boost::beast::http::field::authorization, "Bearer other");
+
+    first.run(*endpoint);
+    second.run(*endpoint);
+    other.run(*endpoint);
+    gate.open();
+
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(second.getBody(), "report for Bearer first");
+    EXPECT_EQ(other.getBody(), "report for Bearer other");
+}
+
+TEST_F(RequestCoalescerTest, ShouldNotShareResponseSettingCookie)
+{
+    auto endpoint = std::make_unique<sd::Endpoint>(sd::HttpMethod::Get, "/report", [this](sd::IContext &ctx) {
+        ctx.getResponse().getHeaders().set("Set-Cookie", "session=" + std::to_string(++calls));
+        ctx.setContinuation(respondAfterGate(ctx));
+    });
+    endpoint->useCoalescing();
+    endpoint->compile();
+    Call leader{services, executor}, follower{services, executor};
+
+    leader.run(*endpoint);
+    follower.run(*endpoint);
+    gate.open();
+
+    EXPECT_TRUE(follower.done);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(follower.ctx.getResponse().getHeaders().get("Set-Cookie"), "session=2");
+}
@@ -0,0 +1,21 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "Common/Json.hpp"
+#include "Http/Results.hpp"
+
+TEST(ResultsTest, ShouldPrecomputeProblemBody)
+{
+    EXPECT_EQ(sd::NotFoundResult::getBody(), R"({"status":404,"title":"Not Found","type":"about:blank"})");
+    EXPECT_EQ(sd::NotFoundResult::getBody().data(), sd::NotFoundResult::getBody().data());
+}
+
+TEST(ResultsTest, ShouldCreateProblemBody)
+{
+    sd::Json errors = {{"id", sd::Json::array({"The value is required."})}};
+
+    EXPECT_EQ(sd::ProblemResult::createBody(409, "Conflict", "Duplicated name"),
+              R"({"detail":"Duplicated name","status":409,"title":"Conflict","type":"about:blank"})");
+    EXPECT_EQ(sd::ProblemResult::createBody(400, "Bad Request", {}, errors),
+              R"({"errors":{"id":["The value is required."]},"status":400,"title":"Bad Request","type":"about:blank"})");
+}
@@ -439,3 +439,34 @@ TEST_F(RouterTest, RegexConstrainTest)
     EXPECT_TRUE(shouldNotMatch("/api/users/hwllo/bob/132"));
     EXPECT_TRUE(shouldNotMatch("/api/users/asd/bob/1"));
 }
+
+TEST_F(RouterTest, CapturesRouteParams)
+{
+    Datas datas = {{"/api/users/{id:int}/bob/{name}"}, {"/api/users/{id:int}/bob"}, {"/api/{any}/man"}};
+
+    addEndpoints(datas);
+    router.compile();
+
+    std::string_view path = "/api/users/12/bob/hello";
+    auto match = router.match(sd::HttpMethod::Get, path);
+    ASSERT_TRUE(match);
+    ASSERT_EQ(match.size(), 2);
+    EXPECT_EQ(match.getValue(path, 0), "12");
+    EXPECT_EQ(match.getValue(path, 1), "hello");
+
+    path = "/api/users/man";
+    match = router.match(sd::HttpMethod::Get, path);
+    ASSERT_TRUE(match);
+    ASSERT_EQ(match.size(), 1);
+    EXPECT_EQ(match.getValue(path, 0), "users");
+}
+
+TEST_F(RouterTest, TooManyRouteParamsTest)
+{
+    std::string path;
+    for (size_t i = 0; i <= sd::RouteMatch::MaxParams; ++i)
+    {
+        path += "/{p" + std::to_string(i) + "}";
+    }
+    EXPECT_THROW(addEndpoints({{path}}), sd::TooManyRouteParams);
+}
@@ -0,0 +1,122 @@
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <coroutine>
+#include <gtest/gtest.h>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Common/Task.hpp"
+#include "Engine/AsioTask.hpp"
+#include "Engine/ServerExecutor.hpp"
+
+namespace
+{
+    using Executor = boost::asio::io_context::executor_type;
+
+    // Completes on its own thread like awaitable of external client library
+    struct ForeignThread
+    {
+        std::thread &thread;
+
+        bool await_ready() const { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) { thread = std::thread{[handle] { handle.resume(); }}; }
+
+        void await_resume() const {}
+    };
+
+    sd::Task<bool> isOnServerThreadAfterForeign(boost::asio::io_context &ioc, std::thread &thread)
+    {
+        co_await ForeignThread{thread};
+        co_return ioc.get_executor().running_in_this_thread();
+    }
+
+    sd::Task<int> failAfterForeign(std::thread &thread)
+    {
+        co_await ForeignThread{thread};
+        throw std::runtime_error("error");
+    }
+
+    sd::Task<> record(sd::IExecutor &executor, std::vector<int> &order, int id)
+    {
+        co_await sd::schedule(executor);
+        order.push_back(id);
+    }
+} // namespace
+
+TEST(ServerExecutorTest, ShouldContinueTaskOnServerThread)
+{
+    boost::asio::io_context ioc;
+    auto work = boost::asio::make_work_guard(ioc);
+    sd::ServerExecutor executor;
+    executor.attach(ioc);
+    std::thread foreign;
+    std::optional<bool> taskOnServerThread;
+    bool completedOnServerThread = false;
+
+    boost::asio::co_spawn(
+        ioc,
+        [&]() -> boost::asio::awaitable<void, Executor> {
+            auto task = isOnServerThreadAfterForeign(ioc, foreign);
+            task.setExecutor(executor);
+            taskOnServerThread = co_await sd::awaitTask(std::move(task));
+            completedOnServerThread = ioc.get_executor().running_in_this_thread();
+            work.reset();
+        },
+        boost::asio::detached);
+    ioc.run();
+    foreign.join();
+
+    EXPECT_EQ(taskOnServerThread, true);
+    EXPECT_TRUE(completedOnServerThread);
+}
+
+TEST(ServerExecutorTest, ShouldPassTaskException)
+{
+    boost::asio::io_context ioc;
+    auto work = boost::asio::make_work_guard(ioc);
+    sd::ServerExecutor executor;
+    executor.attach(ioc);
+    std::thread foreign;
+    bool thrown = false;
+
+    boost::asio::co_spawn(
+        ioc,
+        [&]() -> boost::asio::awaitable<void, Executor> {
+            auto task = failAfterForeign(foreign);
+            task.setExecutor(executor);
+            try
+            {
+                co_await sd::awaitTask(std::move(task));
+            }
+            catch (std::runtime_error &)
+            {
+                thrown = true;
+            }
+            work.reset();
+        },
+        boost::asio::detached);
+    ioc.run();
+    foreign.join();
+
+    EXPECT_TRUE(thrown);
+}
+
+TEST(ServerExecutorTest, ShouldQueueHandlesPostedWhileDrainingWhenNotAttached)
+{
+    sd::ServerExecutor executor;
+    std::vector<int> order;
+    auto outer = [&]() -> sd::Task<> {
+        co_await sd::schedule(executor);
+        sd::startTask(record(executor, order, 2), [](std::exception_ptr) {});
+        order.push_back(1);
+    };
+
+    sd::startTask(outer(), [](std::exception_ptr) {});
+
+    EXPECT_EQ(order, (std::vector<int>{1, 2}));
+}
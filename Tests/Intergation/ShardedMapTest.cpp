@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/ShardedMap.hpp"
+
+TEST(ShardedMapTest, ShouldKeepValuesPerKey)
+{
+    sd::utils::ShardedMap<std::string, int> map;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        map.apply(std::to_string(i), [&](auto &shard) { shard[std::to_string(i)] = i; });
+    }
+
+    EXPECT_EQ(map.size(), 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        auto key = std::to_string(i);
+        EXPECT_EQ(map.apply(key, [&](auto &shard) { return shard.at(key); }), i);
+    }
+    EXPECT_TRUE(map.erase("42"));
+    EXPECT_FALSE(map.erase("42"));
+    EXPECT_EQ(map.size(), 99);
+}
+
+TEST(ShardedMapTest, ShouldUpdateConcurrently)
+{
+    sd::utils::ShardedMap<int, int> map;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 1000; ++i)
+            {
+                map.apply(i % 64, [&](auto &shard) { ++shard[i % 64]; });
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(map.size(), 64);
+    int total = 0;
+    for (int i = 0; i < 64; ++i)
+    {
+        total += map.apply(i, [&](auto &shard) { return shard[i]; });
+    }
+    EXPECT_EQ(total, 8000);
+}
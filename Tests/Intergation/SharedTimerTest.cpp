@@ -0,0 +1,65 @@
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <optional>
+#include <thread>
+
+#include "Common/SharedTimer.hpp"
+
+TEST(SharedTimerTest, ShouldRunTimerUntilItStops)
+{
+    sd::SharedTimer timer;
+    std::atomic<int> runs = 0;
+
+    timer.start(sd::SharedTimer::Clock::now(), [&]() -> std::optional<sd::SharedTimer::Clock::time_point> {
+        if (++runs == 3)
+        {
+            return std::nullopt;
+        }
+        return sd::SharedTimer::Clock::now() + std::chrono::milliseconds{1};
+    });
+
+    for (int i = 0; i < 200 && runs < 3; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+    EXPECT_EQ(runs, 3);
+}
+
+TEST(SharedTimerTest, ShouldNotRunCancelledTimer)
+{
+    sd::SharedTimer timer;
+    std::atomic<int> runs = 0;
+
+    auto id = timer.start(sd::SharedTimer::Clock::now() + std::chrono::milliseconds{20}, [&] {
+        ++runs;
+        return std::optional{sd::SharedTimer::Clock::now()};
+    });
+    timer.cancel(id);
+    std::this_thread::sleep_for(std::chrono::milliseconds{40});
+
+    EXPECT_EQ(runs, 0);
+}
+
+TEST(SharedTimerTest, ShouldWaitForRunningCallbackWhenCancelled)
+{
+    sd::SharedTimer timer;
+    std::atomic<bool> started = false;
+    std::atomic<bool> finished = false;
+
+    auto id = timer.start(sd::SharedTimer::Clock::now(), [&] {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        finished = true;
+        return std::optional{sd::SharedTimer::Clock::now()};
+    });
+    while (!started)
+    {
+        std::this_thread::yield();
+    }
+    timer.cancel(id);
+
+    EXPECT_TRUE(finished);
+}
@@ -0,0 +1,110 @@
+#include <boost/asio/ssl/context.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <string>
+#include <vector>
+
+#include "Common/ServerSettings.hpp"
+#include "Engine/CertLoader.hpp"
+#include "Engine/SslContextProvider.hpp"
+
+class SslContextProviderTest : public ::testing::Test
+{
+  protected:
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "SslContextProviderTest";
+    std::string certificateFile = (dir / "cert.pem").string();
+    std::string privateKeyFile = (dir / "key.pem").string();
+
+    // built in certificate written to files, so certificates can be loaded from disk
+    void SetUp() override
+    {
+        std::filesystem::create_directories(dir);
+        boost::asio::ssl::context context{boost::asio::ssl::context::tlsv12};
+        sd::CertLoader::load(context);
+
+        auto certificate = BIO_new_file(certificateFile.c_str(), "w");
+        PEM_write_bio_X509(certificate, SSL_CTX_get0_certificate(context.native_handle()));
+        BIO_free(certificate);
+
+        auto key = BIO_new_file(privateKeyFile.c_str(), "w");
+        PEM_write_bio_PrivateKey(key, SSL_CTX_get0_privatekey(context.native_handle()), nullptr, nullptr, 0, nullptr,
+                                 nullptr);
+        BIO_free(key);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir); }
+
+    sd::CertificateSettings makeCertificate(std::vector<std::string> hosts)
+    {
+        return {.hosts = std::move(hosts), .certificateFile = certificateFile, .privateKeyFile = privateKeyFile};
+    }
+};
+
+TEST_F(SslContextProviderTest, ShouldSelectContextByHostName)
+{
+    sd::ServerSettings settings;
+    settings.certificates = {makeCertificate({"api.example.com"}), makeCertificate({"*.example.com"})};
+    sd::SslContextSet set{settings};
+
+    auto exact = set.find("API.Example.com");
+    auto wildcard = set.find("www.EXAMPLE.com");
+
+    ASSERT_NE(exact, nullptr);
+    ASSERT_NE(wildcard, nullptr);
+    EXPECT_NE(exact, wildcard);
+    EXPECT_EQ(&set.getDefault(), exact);
+}
+
+TEST_F(SslContextProviderTest, ShouldFallBackToDefaultContext)
+{
+    sd::ServerSettings settings;
+    settings.certificateFile = certificateFile;
+    settings.privateKeyFile = privateKeyFile;
+    settings.certificates = {makeCertificate({"*.example.com"})};
+    sd::SslContextSet set{settings};
+
+    ASSERT_NE(set.find("www.example.com"), nullptr);
+    EXPECT_NE(set.find("www.example.com"), &set.getDefault());
+    EXPECT_EQ(set.find("example.com"), nullptr);
+    EXPECT_EQ(set.find("a.www.example.com"), nullptr);
+    EXPECT_EQ(set.find("www.example.org"), nullptr);
+}
+
+TEST_F(SslContextProviderTest, ShouldReloadChangedFiles)
+{
+    sd::ServerSettings settings;
+    settings.certificateFile = certificateFile;
+    settings.privateKeyFile = privateKeyFile;
+    sd::SslContextProvider provider{settings};
+
+    auto contexts = provider.get();
+    EXPECT_FALSE(provider.reloadIfChanged());
+    EXPECT_EQ(provider.get(), contexts);
+
+    std::filesystem::last_write_time(certificateFile,
+                                     std::filesystem::last_write_time(certificateFile) + std::chrono::seconds{1});
+
+    EXPECT_TRUE(provider.reloadIfChanged());
+    EXPECT_NE(provider.get(), contexts);
+    EXPECT_FALSE(provider.reloadIfChanged());
+}
+
+TEST_F(SslContextProviderTest, ShouldKeepContextsWhenReloadFails)
+{
+    sd::ServerSettings settings;
+    settings.certificateFile = certificateFile;
+    settings.privateKeyFile = privateKeyFile;
+    sd::SslContextProvider provider{settings};
+    auto contexts = provider.get();
+
+    std::ofstream{privateKeyFile} << "invalid";
+    std::filesystem::last_write_time(privateKeyFile,
+                                     std::filesystem::last_write_time(privateKeyFile) + std::chrono::seconds{1});
+
+    EXPECT_ANY_THROW(provider.reloadIfChanged());
+    EXPECT_EQ(provider.get(), contexts);
+}
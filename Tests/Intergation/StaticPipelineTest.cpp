@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "Middlewares/StaticPipeline.hpp"
+#include "SevenBitRest.hpp"
+
+using namespace std::string_literals;
+
+namespace
+{
+    void addStep(sd::IContext &ctx, const std::string &step)
+    {
+        auto &headers = ctx.getResponse().getHeaders();
+        headers.set("X-Steps", std::string{headers.getOrAdd("X-Steps")} + step);
+    }
+
+    struct VirtualMiddleware final : sd::IMiddleware
+    {
+        void next(sd::IContext &ctx, sd::INextCallback &callback) final
+        {
+            addStep(ctx, "v");
+            callback.next();
+        }
+    };
+
+    struct StaticMiddleware final : sd::IMiddleware
+    {
+        void next(sd::IContext &ctx, sd::INextCallback &callback) final
+        {
+            addStep(ctx, "virtual");
+            callback.next();
+        }
+
+        template <class NextCallback> void handle(sd::IContext &ctx, NextCallback &callback)
+        {
+            addStep(ctx, "s");
+            callback.next();
+        }
+    };
+
+    struct StopMiddleware final : sd::IMiddleware
+    {
+        void next(sd::IContext &ctx, sd::INextCallback &) final
+        {
+            addStep(ctx, "x");
+            ctx.getResponse().setStatusCode(204);
+        }
+    };
+} // namespace
+
+TEST(StaticPipelineTest, ShouldRunMiddlewaresInOrder)
+{
+    auto app = sd::WebApplicationBuilder{}.build();
+    sd::TestServer server{app};
+    app.usePipeline<VirtualMiddleware, StaticMiddleware, VirtualMiddleware>();
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    auto response = server.get("/hello");
+
+    EXPECT_EQ(response.statusCode, 200);
+    EXPECT_EQ(response.body, "Hello, world!");
+    EXPECT_EQ(response.getHeader("X-Steps"), "vsv");
+}
+
+TEST(StaticPipelineTest, ShouldStopWhenMiddlewareDoesNotCallNext)
+{
+    auto app = sd::WebApplicationBuilder{}.build();
+    sd::TestServer server{app};
+    app.usePipeline<StaticMiddleware, StopMiddleware, VirtualMiddleware>();
+    app.mapGet("/hello", []() { return "Hello, world!"s; });
+
+    auto response = server.get("/hello");
+
+    EXPECT_EQ(response.statusCode, 204);
+    EXPECT_EQ(response.getHeader("X-Steps"), "sx");
+}
+
+TEST(StaticPipelineTest, ShouldReportContainedMiddlewares)
+{
+    using Pipeline = sd::StaticPipeline<VirtualMiddleware, StaticMiddleware>;
+    sd::StaticPipelineCreator<VirtualMiddleware, StaticMiddleware> creator{nullptr};
+
+    EXPECT_TRUE(Pipeline::contains<StaticMiddleware>());
+    EXPECT_FALSE(Pipeline::contains<StopMiddleware>());
+    EXPECT_TRUE(creator.provides(typeid(VirtualMiddleware)));
+    EXPECT_FALSE(creator.provides(typeid(StopMiddleware)));
+    EXPECT_EQ(creator.getLifetime(), sd::MiddlewareLifetime::Singleton);
+}
@@ -0,0 +1,113 @@
+#include <coroutine>
+#include <exception>
+#include <gtest/gtest.h>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Common/IExecutor.hpp"
+#include "Common/Task.hpp"
+
+namespace
+{
+    sd::Task<int> getNumber() { co_return 42; }
+
+    sd::Task<std::string> getText() { co_return std::to_string(co_await getNumber()); }
+
+    sd::Task<> fail()
+    {
+        throw std::runtime_error("error");
+        co_return;
+    }
+
+    // Executor of other thread, posted handles are resumed by test
+    struct ManualExecutor final : sd::IExecutor
+    {
+        std::vector<std::coroutine_handle<>> posted;
+
+        void post(std::coroutine_handle<> handle) { posted.push_back(handle); }
+
+        bool runningInThisThread() const { return false; }
+    };
+
+    // Completes inside await_suspend like awaitable resumed by foreign thread
+    struct ResumeInline
+    {
+        bool await_ready() const { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) const { handle.resume(); }
+
+        void await_resume() const {}
+    };
+
+    sd::Task<int> getNumberAfterResume()
+    {
+        co_await ResumeInline{};
+        co_return 42;
+    }
+
+    sd::Task<std::string> getTextAfterResume() { co_return std::to_string(co_await getNumberAfterResume()); }
+} // namespace
+
+TEST(TaskTest, ShouldRunNestedTasks)
+{
+    std::optional<std::string> result;
+
+    sd::startTask(getText(), [&](std::exception_ptr exception, std::optional<std::string> value) {
+        EXPECT_FALSE(exception);
+        result = std::move(value);
+    });
+
+    EXPECT_EQ(result, "42");
+}
+
+TEST(TaskTest, ShouldPassException)
+{
+    std::exception_ptr result;
+
+    sd::startTask(fail(), [&](std::exception_ptr exception) { result = exception; });
+
+    EXPECT_THROW(std::rethrow_exception(result), std::runtime_error);
+}
+
+TEST(TaskTest, ShouldNotRunUntilAwaited)
+{
+    bool started = false;
+    {
+        auto task = [&]() -> sd::Task<> {
+            started = true;
+            co_return;
+        }();
+    }
+
+    EXPECT_FALSE(started);
+}
+
+TEST(TaskTest, ShouldThrowWhenAwaitingEmptyTask)
+{
+    std::exception_ptr result;
+    auto awaitEmpty = []() -> sd::Task<> {
+        sd::Task<> empty;
+        co_await empty;
+    };
+
+    sd::startTask(awaitEmpty(), [&](std::exception_ptr exception) { result = exception; });
+
+    EXPECT_THROW(std::rethrow_exception(result), std::runtime_error);
+}
+
+TEST(TaskTest, ShouldResumeNestedTaskThroughExecutor)
+{
+    ManualExecutor executor;
+    std::optional<std::string> result;
+    auto task = getTextAfterResume();
+    task.setExecutor(executor);
+
+    sd::startTask(std::move(task), [&](std::exception_ptr, std::optional<std::string> value) { result = value; });
+
+    EXPECT_FALSE(result);
+    ASSERT_EQ(executor.posted.size(), 1);
+    executor.posted.front().resume();
+    EXPECT_EQ(result, "42");
+}